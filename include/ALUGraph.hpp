@@ -19,10 +19,14 @@
 class ALUGraph : public AbstractUGraph
 {
 public:
+  //--------- Types ----------//
+
+  typedef VertexSpan NeighborRange;
+
   //--------- Constructors --------//
 
   /// size constructor
-  ALUGraph( size_type const size ) : _adjacencies(size) { }
+  ALUGraph( size_type const size ) : _adjacencies(checkedVertexCount(size)) { }
 
   /// input stream constructor
   ALUGraph( std::istream & in );
@@ -47,6 +51,13 @@ public:
     return _adjacencies[v];
   }
 
+  /// Non-owning range over the vertices adjacent to `v`
+  NeighborRange neighbors( VertexID const v ) const
+  {
+    AdjacencyList const& adj_list = _adjacencies[v];
+    return NeighborRange( adj_list.data(), adj_list.data() + adj_list.size() );
+  }
+
   /// Degree of vertex `v`
   size_type degree( VertexID const v ) const
   {
@@ -9,20 +9,102 @@
 #pragma once
 
 #include "AbstractUGraph.hpp"
+#include "BitKernels.hpp"
 
 #include <cstddef> // size_t
 #include <istream> // istream
+#include <iterator> // forward_iterator_tag
 #include <vector> // vector
 #include <ostream> // ostream
 
 /// Basic undirected graph using an adjacency matrix.
+///
+/// The matrix is one contiguous array of 64-bit words. Each row is padded
+/// to a whole number of 256-bit vectors so that row kernels never straddle
+/// two rows.
 class AMUGraph : public AbstractUGraph
 {
 public:
+  //--------- Types ----------//
+
+  typedef BitKernels::Word Word;
+
+  /// Non-owning range over the set bits of one matrix row
+  class NeighborRange
+  {
+  public:
+    /// Forward iterator yielding the column of each set bit
+    class const_iterator
+    {
+    public:
+      typedef std::forward_iterator_tag iterator_category;
+      typedef VertexID value_type;
+      typedef std::ptrdiff_t difference_type;
+      typedef VertexID const* pointer;
+      typedef VertexID reference;
+
+      const_iterator( Word const* row, size_type const word_count, size_type const word_index ) :
+        _row(row), _word_count(word_count), _word_index(word_index), _word(0)
+      {
+        loadNonZeroWord();
+      }
+
+      VertexID operator*() const
+      {
+        return _word_index * BitKernels::WORD_BITS + BitKernels::countTrailingZeros( _word );
+      }
+
+      const_iterator& operator++()
+      {
+        // clear the lowest set bit; move on to the next nonzero word when empty
+        _word &= _word - 1;
+        if ( _word == 0 ) {
+          ++_word_index;
+          loadNonZeroWord();
+        }
+        return *this;
+      }
+
+      const_iterator operator++( int ) { const_iterator it = *this; ++*this; return it; }
+
+      bool operator==( const_iterator const& other ) const
+      {
+        return _word_index == other._word_index && _word == other._word;
+      }
+      bool operator!=( const_iterator const& other ) const { return !(*this == other); }
+
+    private:
+      void loadNonZeroWord()
+      {
+        _word_index = BitKernels::nextNonZeroWord( _row, _word_index, _word_count );
+        _word = _word_index < _word_count ? _row[_word_index] : 0;
+      }
+
+      Word const* _row;
+      size_type _word_count;
+      size_type _word_index;
+      Word _word; ///< bits of the current word not yet visited
+    };
+    typedef const_iterator iterator;
+
+    NeighborRange( Word const* row, size_type const word_count ) : _row(row), _word_count(word_count) { }
+
+    const_iterator begin() const { return const_iterator( _row, _word_count, 0 ); }
+    const_iterator end() const   { return const_iterator( _row, _word_count, _word_count ); }
+
+  private:
+    Word const* _row;
+    size_type _word_count;
+  };
+
   //--------- Constructors --------//
 
   /// size constructor
-  AMUGraph( size_type const size ) : _matrix(size, std::vector<bool>(size)) { }
+  AMUGraph( size_type const size ) :
+    _vertex_count(checkedVertexCount(size)),
+    _row_words(BitKernels::paddedWordsFor(size)),
+    _bits(size * _row_words, 0)
+  { }
 
   /// input stream constructor
   AMUGraph( std::istream & in );
@@ -30,47 +112,67 @@ public:
   //--------- Accessors ---------//
 
   /// Number of vertices
-  size_type v() const { return _matrix.size(); }
+  size_type v() const { return _vertex_count; }
 
   /// Number of edges
   size_type e() const
   {
-    size_type edge_count = 0;
-    for ( size_type row = 0; row < v(); ++row )
-      edge_count += std::count( _matrix[row].begin() + row, _matrix[row].end(), true );
-    return edge_count;
+    // every edge sets two bits except a self-loop, which sets one
+    size_type self_loops = 0;
+    for ( VertexID row = 0; row < v(); ++row )
+      self_loops += hasEdge( row, row );
+    return (BitKernels::popcountRange( _bits.data(), _bits.size() ) + self_loops) / 2;
   }
 
   /// Vertices adjacent to the given vertex
   AdjacencyList verticesAdjacentTo( VertexID const v ) const
   {
-    AdjacencyList adj_list;
-    typedef std::vector<bool>::const_iterator citer;
-    for ( citer it = _matrix[v].begin(); it != _matrix[v].end(); ++it )
-      if ( *it )
-        adj_list.push_back( it-_matrix[v].begin() );
-    return adj_list;
+    NeighborRange const range = neighbors( v );
+    return AdjacencyList( range.begin(), range.end() );
+  }
+
+  /// Non-owning range over the vertices adjacent to `v`
+  NeighborRange neighbors( VertexID const v ) const
+  {
+    return NeighborRange( row(v), _row_words );
   }
 
   /// Degree of vertex `v`; a self-loop is counted twice.
   virtual size_type degree( VertexID const v ) const
   {
-    return std::count( _matrix[v].begin(), _matrix[v].end(), true ) + (_matrix[v][v] ? 1 : 0);
+    return BitKernels::popcountRange( row(v), _row_words ) + (hasEdge( v, v ) ? 1 : 0);
   }
 
+  /// Whether there is an edge between `v` and `w`
+  bool hasEdge( VertexID const v, VertexID const w ) const
+  {
+    return BitKernels::testBit( row(v), w );
+  }
+
+  /// The raw bits of row `v`, `rowWords()` words
+  Word const* rowData( VertexID const v ) const { return row( v ); }
+
+  /// Words per row, including padding
+  size_type rowWords() const { return _row_words; }
+
   //--------- Mutators ---------//
 
   /// Creates an edge between the two named vertices.
   /// It is possible to add the same edge twice.
   void addEdge( VertexID const v, VertexID const w )
   {
-    _matrix[v][w] = _matrix[w][v] = true;
+    BitKernels::setBit( row(v), w );
+    BitKernels::setBit( row(w), v );
   }
 
 private:
 
-  typedef std::vector<std::vector<bool>> AdjacencyMatrix;
-  AdjacencyMatrix _matrix;
+  Word const* row( VertexID const v ) const { return _bits.data() + v * _row_words; }
+  Word* row( VertexID const v )             { return _bits.data() + v * _row_words; }
+
+  size_type _vertex_count;
+  size_type _row_words;    ///< words per row, including padding
+  std::vector<Word> _bits; ///< row-major bit matrix
 
 };
 
@@ -9,11 +9,16 @@
 #pragma once
 
 #include <cstddef> // size_t
+#include <cstdint> // uint32_t
+#include <limits> // numeric_limits
+#include <stdexcept> // overflow_error, out_of_range
+#include <string> // string, to_string
 #include <istream> // istream
 #include <vector> // vector
 #include <sstream> // ostringstream
 #include <ios> // streamsize
 #include <cmath> // log10, ceil
+#include <utility> // pair
 
 /// Abstract, basic undirected graph.
 class AbstractUGraph
@@ -21,10 +26,52 @@ class AbstractUGraph
 public:
   //--------- Types ----------//
 
-  /// vertex ID type
+  /// vertex ID type; configure with GRAPHS_32BIT_VERTEX_IDS to halve the
+  /// memory used by adjacency storage and the per-vertex search arrays
+#ifdef GRAPHS_32BIT_VERTEX_IDS
+  typedef std::uint32_t VertexID;
+#else
   typedef size_t VertexID;
+#endif
   typedef size_t size_type;
   typedef std::vector<VertexID> AdjacencyList;
+  typedef std::pair<VertexID, VertexID> Edge;
+  typedef std::vector<Edge> EdgeList;
+
+  /// Non-owning view of a contiguous run of vertex IDs. Valid until the
+  /// graph it was taken from is modified or destroyed.
+  class VertexSpan
+  {
+  public:
+    typedef VertexID const* const_iterator;
+    typedef const_iterator iterator;
+
+    VertexSpan( VertexID const* first, VertexID const* last ) : _first(first), _last(last) { }
+
+    const_iterator begin() const { return _first; }
+    const_iterator end() const   { return _last; }
+    size_t size() const          { return _last - _first; }
+    bool empty() const           { return _first == _last; }
+    VertexID operator[]( size_t const i ) const { return _first[i]; }
+
+  private:
+    VertexID const* _first;
+    VertexID const* _last;
+  };
+
+  /// Largest number of vertices a graph can have with this `VertexID`
+  static constexpr size_type MAX_VERTEX_COUNT = size_type( std::numeric_limits<VertexID>::max() );
+
+  /// Returns `vertex_count`, or throws `std::overflow_error` if some of its
+  /// vertices could not be named by a `VertexID`
+  static size_type checkedVertexCount( size_type const vertex_count )
+  {
+    if ( vertex_count > MAX_VERTEX_COUNT )
+      throw std::overflow_error(
+          std::to_string(vertex_count) + " vertices don't fit in " +
+          std::to_string(8 * sizeof(VertexID)) + "-bit vertex IDs" );
+    return vertex_count;
+  }
 
   //--------- Constructors --------//
 
@@ -43,7 +90,10 @@ public:
   /// Number of edges
   virtual size_type e() const = 0;
 
-  /// Vertices adjacent to the given vertex
+  /// Vertices adjacent to the given vertex, as a copy.
+  /// Concrete graphs also provide a non-virtual `neighbors(v)` returning a
+  /// non-owning range over the same vertices; the algorithm templates use
+  /// that so that traversal does not allocate.
   virtual AdjacencyList verticesAdjacentTo( VertexID const v ) const = 0;
 
   /// Degree of vertex `v`; a self-loop is considered to add two to this count.
@@ -90,12 +140,17 @@ public:
 
 protected:
 
-  /// Read in `edge_count` edges
+  /// Read in `edge_count` edges; throws `std::out_of_range` on a vertex ID
+  /// that is not in the graph
   void readEdges( std::istream& in, size_type edge_count )
   {
     for ( size_type i = 0; i < edge_count; ++i ) {
-      VertexID v, w;
+      size_type v, w;
       in >> v >> w;
+      if ( v >= this->v() || w >= this->v() )
+        throw std::out_of_range(
+            "Edge (" + std::to_string(v) + ", " + std::to_string(w) +
+            ") is out of range for a graph with " + std::to_string(this->v()) + " vertices" );
       addEdge( v, w );
     }
   }
@@ -0,0 +1,127 @@
+/** \file Biconnectivity.hpp
+  * Bridges, articulation points and biconnected components.
+  *
+  * \author Brian Heim
+  * \date   2026-10-17
+  */
+
+#pragma once
+
+#include "DepthFirstTraversal.hpp"
+
+#include <cstddef> // size_t
+#include <limits> // numeric_limits
+#include <utility> // pair
+#include <vector>
+
+/// The 2-connected structure of a graph, after Hopcroft and Tarjan.
+///
+/// One `DepthFirstTraversal` gives every vertex its parent and low-link,
+/// and everything else follows in linear time without recursion:
+///
+///   - tree edge (p, v) is a bridge when nothing below v reaches above v
+///   - p is an articulation point when some child's subtree can't get above
+///     p (or, for a root, when it has two children)
+///   - a child whose subtree can't get above its parent p starts a new
+///     biconnected component, which holds p and the child's subtree minus
+///     the subtrees of children that start components of their own
+///
+/// Components are vertex sets; articulation points belong to several.
+/// Vertices without edges belong to none, and self-loops are ignored.
+template<class G> class Biconnectivity
+{
+public:
+  typedef typename G::VertexID V_ID;
+  typedef typename G::size_type size_type;
+  typedef std::pair<V_ID, V_ID> Edge;
+
+  /// Find the bridges, articulation points and biconnected components of `g`
+  explicit Biconnectivity( G const& g ) :
+    _articulation(g.v(), false),
+    _bridges(),
+    _component_starts(1, 0),
+    _component_vertices()
+  {
+    DepthFirstTraversal<G> const dfs( g );
+    V_ID const NO_PARENT = DepthFirstTraversal<G>::NO_PARENT;
+
+    // component of each non-root vertex, assigned in preorder so that a
+    // parent's is known before its children's
+    std::vector<V_ID> components( g.v(), NO_COMPONENT );
+    std::vector<V_ID> root_children( g.v(), 0 );
+    std::vector<size_type> sizes;
+    for ( auto const v : dfs.preorderVertices() ) {
+      V_ID const p = dfs.parent( v );
+      if ( p == NO_PARENT )
+        continue;
+
+      if ( dfs.low(v) == dfs.preorder(v) )
+        _bridges.push_back( Edge( p, v ) );
+
+      if ( dfs.low(v) >= dfs.preorder(p) ) {
+        // v's subtree can't get around p
+        if ( dfs.parent(p) != NO_PARENT )
+          _articulation[p] = true;
+        else if ( ++root_children[p] == 2 )
+          _articulation[p] = true;
+        components[v] = sizes.size();
+        sizes.push_back( 2 ); // v and p
+      } else {
+        components[v] = components[p];
+        ++sizes[components[v]];
+      }
+    }
+
+    // lay the components out one after another, each starting with the
+    // parent that closes it
+    _component_starts.resize( sizes.size() + 1 );
+    for ( size_t c = 0; c < sizes.size(); ++c )
+      _component_starts[c+1] = _component_starts[c] + sizes[c];
+    _component_vertices.resize( _component_starts.back() );
+    std::vector<size_type> next( _component_starts.begin(), _component_starts.end() - 1 );
+    for ( auto const v : dfs.preorderVertices() ) {
+      V_ID const c = components[v];
+      if ( c == NO_COMPONENT )
+        continue;
+      if ( next[c] == _component_starts[c] )
+        _component_vertices[next[c]++] = dfs.parent( v );
+      _component_vertices[next[c]++] = v;
+    }
+  }
+
+  /// Whether removing `v` would disconnect its component
+  bool isArticulationPoint( V_ID v ) const { return _articulation[v]; }
+
+  /// Every articulation point, in increasing order
+  std::vector<V_ID> articulationPoints() const
+  {
+    std::vector<V_ID> points;
+    for ( V_ID v = 0; v < _articulation.size(); ++v )
+      if ( _articulation[v] )
+        points.push_back( v );
+    return points;
+  }
+
+  /// Edges whose removal would disconnect their component, as (parent,
+  /// child) pairs of the depth-first forest
+  std::vector<Edge> const& bridges() const { return _bridges; }
+
+  /// Number of biconnected components
+  size_type componentCount() const { return _component_starts.size() - 1; }
+
+  /// Vertices of the `i`th biconnected component
+  std::vector<V_ID> component( size_type const i ) const
+  {
+    return std::vector<V_ID>( _component_vertices.begin() + _component_starts[i],
+                              _component_vertices.begin() + _component_starts[i+1] );
+  }
+
+private:
+
+  static constexpr V_ID NO_COMPONENT = std::numeric_limits<V_ID>::max();
+
+  std::vector<bool> _articulation;
+  std::vector<Edge> _bridges;
+  std::vector<size_type> _component_starts;   ///< offsets into `_component_vertices`
+  std::vector<V_ID> _component_vertices;
+};
@@ -0,0 +1,77 @@
+/** \file BinaryGraphFormat.hpp
+ * Versioned binary graph file holding CSR arrays that can be mapped and
+ * used in place.
+ *
+ * Layout, all integers in the writer's native byte order:
+ *
+ *     Header                     64 bytes
+ *     offsets[vertex_count + 1]  uint64
+ *     neighbors[neighbor_count]  vertex_id_bytes each
+ *
+ * \author Brian Heim
+ * \date   2026-10-17
+ */
+
+#pragma once
+
+#include "CSRUGraph.hpp"
+
+#include <cstdint> // uint32_t, uint64_t
+#include <string> // string
+
+namespace BinaryGraphFormat {
+
+/// Current format version; readers reject any other version
+static constexpr std::uint32_t VERSION = 1;
+
+/// Written as a native integer so a reader can detect a byte-order mismatch
+static constexpr std::uint32_t BYTE_ORDER_MARK = 0x01020304;
+
+/// Header flag bits
+enum Flags : std::uint32_t
+{
+  SORTED_ADJACENCY = 1u << 0, ///< every adjacency list is in ascending order
+};
+
+/// Fixed-size file header
+struct Header
+{
+  char magic[8];                ///< "SWGRAPH" followed by a NUL
+  std::uint32_t version;
+  std::uint32_t flags;          ///< bitwise OR of `Flags`
+  std::uint64_t vertex_count;
+  std::uint64_t edge_count;     ///< undirected edges, as returned by `e()`
+  std::uint64_t neighbor_count; ///< total length of the adjacency lists
+  std::uint32_t vertex_id_bytes;
+  std::uint32_t byte_order;     ///< `BYTE_ORDER_MARK`
+  std::uint64_t reserved[2];
+};
+
+static_assert( sizeof(Header) == 64, "binary graph header must stay 64 bytes" );
+
+/// Byte offset of the offsets array
+constexpr std::uint64_t offsetsPosition() { return sizeof(Header); }
+
+/// Byte offset of the neighbor array
+constexpr std::uint64_t neighborsPosition( std::uint64_t const vertex_count )
+{
+  return offsetsPosition() + (vertex_count + 1) * sizeof(std::uint64_t);
+}
+
+/// Fills in a header for a graph with the given counts and flags
+Header makeHeader( std::uint64_t const vertex_count, std::uint64_t const edge_count,
+                   std::uint64_t const neighbor_count, std::uint32_t const flags );
+
+/// Whether `filename` starts with the binary graph magic number
+bool isBinaryGraphFile( std::string const& filename );
+
+/// Writes `graph` to `filename`. Throws `std::system_error` on I/O failure.
+void write( CSRUGraph const& graph, std::string const& filename );
+
+/// Maps `filename` read-only and returns a graph that uses the mapped
+/// arrays in place. Throws `std::runtime_error` if the header is invalid,
+/// was written with a different vertex ID width or byte order, or the
+/// file is truncated. Adjacency contents are trusted, not scanned.
+CSRUGraph map( std::string const& filename );
+
+} // namespace BinaryGraphFormat
@@ -0,0 +1,182 @@
+/** \file BitKernels.hpp
+ * Word-level bit manipulation kernels shared by the bit-packed structures.
+ *
+ * The range kernels pick an AVX2 implementation at run time when the CPU
+ * supports it, and fall back to portable scalar code otherwise.
+ *
+ * \author Brian Heim
+ * \date   2026-10-17
+ */
+
+#pragma once
+
+#include <cstddef> // size_t
+#include <cstdint> // uint64_t
+
+#if defined(__x86_64__) || defined(__i386__)
+#define GRAPHS_HAVE_X86_DISPATCH 1
+#include <immintrin.h>
+#endif
+
+namespace BitKernels {
+
+typedef std::uint64_t Word;
+
+static constexpr size_t WORD_BITS = 64;
+
+/// Number of words needed to hold `bits` bits
+constexpr size_t wordsFor( size_t const bits ) { return (bits + WORD_BITS - 1) / WORD_BITS; }
+
+/// Number of words needed to hold `bits` bits, rounded up to a whole
+/// 256-bit vector so vector loops over a row never need a partial tail
+constexpr size_t paddedWordsFor( size_t const bits ) { return (wordsFor(bits) + 3) & ~size_t(3); }
+
+/// Number of set bits in `w`
+inline unsigned popcount( Word const w ) { return __builtin_popcountll( w ); }
+
+/// Index of the lowest set bit in `w`; `w` must be nonzero
+inline unsigned countTrailingZeros( Word const w ) { return __builtin_ctzll( w ); }
+
+/// Tests bit `i` of a packed bit array
+inline bool testBit( Word const* words, size_t const i )
+{
+  return (words[i / WORD_BITS] >> (i % WORD_BITS)) & 1;
+}
+
+/// Sets bit `i` of a packed bit array
+inline void setBit( Word* words, size_t const i )
+{
+  words[i / WORD_BITS] |= Word(1) << (i % WORD_BITS);
+}
+
+namespace detail {
+
+inline size_t popcountScalar( Word const* words, size_t const count )
+{
+  size_t total = 0;
+  for ( size_t i = 0; i < count; ++i )
+    total += popcount( words[i] );
+  return total;
+}
+
+inline size_t andPopcountScalar( Word const* a, Word const* b, size_t const count )
+{
+  size_t total = 0;
+  for ( size_t i = 0; i < count; ++i )
+    total += popcount( a[i] & b[i] );
+  return total;
+}
+
+inline size_t nextNonZeroScalar( Word const* words, size_t i, size_t const count )
+{
+  while ( i < count && words[i] == 0 )
+    ++i;
+  return i;
+}
+
+#ifdef GRAPHS_HAVE_X86_DISPATCH
+
+/// Nibble-lookup population count (Mula et al.) of each 64-bit lane of `v`
+__attribute__((target("avx2")))
+inline __m256i popcountLanesAVX2( __m256i const v )
+{
+  __m256i const lookup = _mm256_setr_epi8(
+      0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4,
+      0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4 );
+  __m256i const low_mask = _mm256_set1_epi8( 0x0f );
+  __m256i const lo = _mm256_and_si256( v, low_mask );
+  __m256i const hi = _mm256_and_si256( _mm256_srli_epi16(v, 4), low_mask );
+  __m256i const bytes = _mm256_add_epi8( _mm256_shuffle_epi8(lookup, lo), _mm256_shuffle_epi8(lookup, hi) );
+  return _mm256_sad_epu8( bytes, _mm256_setzero_si256() );
+}
+
+__attribute__((target("avx2")))
+inline size_t sumLanesAVX2( __m256i const totals )
+{
+  return _mm256_extract_epi64( totals, 0 ) + _mm256_extract_epi64( totals, 1 )
+       + _mm256_extract_epi64( totals, 2 ) + _mm256_extract_epi64( totals, 3 );
+}
+
+/// 256 bits per step
+__attribute__((target("avx2")))
+inline size_t popcountAVX2( Word const* words, size_t const count )
+{
+  __m256i totals = _mm256_setzero_si256();
+  size_t i = 0;
+  for ( ; i + 4 <= count; i += 4 ) {
+    __m256i const v = _mm256_loadu_si256( reinterpret_cast<__m256i const*>(words + i) );
+    totals = _mm256_add_epi64( totals, popcountLanesAVX2(v) );
+  }
+  return sumLanesAVX2( totals ) + popcountScalar( words + i, count - i );
+}
+
+/// Counts the AND of two 256-bit vectors per step, without storing it
+__attribute__((target("avx2")))
+inline size_t andPopcountAVX2( Word const* a, Word const* b, size_t const count )
+{
+  __m256i totals = _mm256_setzero_si256();
+  size_t i = 0;
+  for ( ; i + 4 <= count; i += 4 ) {
+    __m256i const va = _mm256_loadu_si256( reinterpret_cast<__m256i const*>(a + i) );
+    __m256i const vb = _mm256_loadu_si256( reinterpret_cast<__m256i const*>(b + i) );
+    totals = _mm256_add_epi64( totals, popcountLanesAVX2(_mm256_and_si256(va, vb)) );
+  }
+  return sumLanesAVX2( totals ) + andPopcountScalar( a + i, b + i, count - i );
+}
+
+/// Skips four zero words per test
+__attribute__((target("avx2")))
+inline size_t nextNonZeroAVX2( Word const* words, size_t i, size_t const count )
+{
+  for ( ; i + 4 <= count; i += 4 ) {
+    __m256i const v = _mm256_loadu_si256( reinterpret_cast<__m256i const*>(words + i) );
+    if ( !_mm256_testz_si256(v, v) )
+      break;
+  }
+  return nextNonZeroScalar( words, i, count );
+}
+
+inline bool cpuHasAVX2()
+{
+  static bool const has_avx2 = __builtin_cpu_supports( "avx2" );
+  return has_avx2;
+}
+
+#endif // GRAPHS_HAVE_X86_DISPATCH
+
+} // namespace detail
+
+/// Total number of set bits in `words[0, count)`
+inline size_t popcountRange( Word const* words, size_t const count )
+{
+#ifdef GRAPHS_HAVE_X86_DISPATCH
+  if ( detail::cpuHasAVX2() )
+    return detail::popcountAVX2( words, count );
+#endif
+  return detail::popcountScalar( words, count );
+}
+
+/// Number of bits set in both `a[0, count)` and `b[0, count)`
+inline size_t andPopcountRange( Word const* a, Word const* b, size_t const count )
+{
+#ifdef GRAPHS_HAVE_X86_DISPATCH
+  if ( detail::cpuHasAVX2() )
+    return detail::andPopcountAVX2( a, b, count );
+#endif
+  return detail::andPopcountScalar( a, b, count );
+}
+
+/// Index of the first nonzero word in `words[from, count)`, or `count`
+inline size_t nextNonZeroWord( Word const* words, size_t const from, size_t const count )
+{
+  // short runs of zeros are common; only bother with vectors past the first word
+  if ( from >= count || words[from] != 0 )
+    return from;
+#ifdef GRAPHS_HAVE_X86_DISPATCH
+  if ( detail::cpuHasAVX2() )
+    return detail::nextNonZeroAVX2( words, from + 1, count );
+#endif
+  return detail::nextNonZeroScalar( words, from + 1, count );
+}
+
+} // namespace BitKernels
@@ -7,97 +7,129 @@
 
 #pragma once
 
+#include "EpochMarks.hpp"
+#include "SearchTracer.hpp"
+
 #include <vector>
-#include <queue>
-#include <ostream>
 
-template<class G> class BreadthFirstSearch
+/// Breadth-first search, usable as a workspace for many searches.
+///
+/// The search binds to the graph by reference, which must outlive it, and
+/// keeps its marks, parents and queue between calls to `search`. Starting a
+/// new search costs O(1), so each query pays only for the vertices it
+/// reaches. Each step is reported to `Tracer` (see SearchTracer.hpp); the
+/// default `NullTracer` compiles away.
+template<class G, class Tracer = NullTracer> class BreadthFirstSearch
 {
 public:
   typedef typename G::VertexID V_ID;
-  typedef std::queue<V_ID> VertexQueue;
 
-  /// Find vertices connected to source vertex `s`
-  BreadthFirstSearch( G g, V_ID s, bool traceProgress, std::ostream& os ) :
-    _marks(g.v(), false),
+  /// Workspace for searches of `g`; call `search` for each source
+  explicit BreadthFirstSearch( G const& g, Tracer const tracer = Tracer() ) :
+    _graph(g),
+    _marks(g.v()),
+    _parents(g.v()),
+    _distances(g.v()),
+    _queue(),
     _count(0),
-    _trace(traceProgress),
-    _out(os)
+    _tracer(tracer)
+  { }
+
+  /// Find vertices connected to source vertex `s`
+  BreadthFirstSearch( G const& g, V_ID s, Tracer const tracer = Tracer() ) :
+    BreadthFirstSearch( g, tracer )
   {
-    // create a queue of vertices to explore
-    VertexQueue vertex_queue;
+    search( s );
+  }
+
+  /// Forget the previous search and find vertices connected to `s`
+  void search( V_ID s )
+  {
+    _marks.reset();
+    _count = 0;
+    _tracer.begin( s );
+
+    // `_queue` holds every vertex visited; [head, end) is still to explore
+    _queue.clear();
+    size_t head = 0;
 
     // add the source to the back of the queue
-    visitVertex( vertex_queue, s );
+    visitVertex( head, s, s );
 
-    while ( !vertex_queue.empty() ) {
+    while ( head < _queue.size() ) {
 
       // get the front item off the queue
-      const V_ID current_vertex = getNextVisitedVertex( vertex_queue );
+      const V_ID current_vertex = getNextVisitedVertex( head );
 
       // for each of that vertex's adjacents
-      for ( auto const adj_vertex : g.verticesAdjacentTo(current_vertex) )
-        checkAdjacent( vertex_queue, adj_vertex );
+      for ( auto const adj_vertex : _graph.neighbors(current_vertex) )
+        checkAdjacent( head, current_vertex, adj_vertex );
     }
   }
 
   /// Is `v` connected to the source vertex?
-  bool marked( V_ID v ) const { return _marks[v]; }
+  bool marked( V_ID v ) const { return _marks.marked(v); }
 
   /// How many vertices are connected to the source?
   size_t count() const { return _count; }
 
+  /// Vertex that `v` was first reached from; the source is its own parent.
+  /// Only meaningful if `v` is marked.
+  V_ID parent( V_ID v ) const { return _parents[v]; }
+
+  /// Number of edges on a shortest path from the source to `v`. Only
+  /// meaningful if `v` is marked.
+  V_ID distance( V_ID v ) const { return _distances[v]; }
+
+  /// Vertices connected to the source in the order they were reached, so
+  /// by distance; the last is one of the farthest
+  std::vector<V_ID> const& visitOrder() const { return _queue; }
+
 private:
 
   /// All the bookkeeping needed to remember a vertex for later processing
-  void visitVertex( VertexQueue& vq, V_ID const id )
+  void visitVertex( size_t const head, V_ID const from, V_ID const id )
   {
     // mark the source (updating the counter)
-    _marks[id] = true;
+    _marks.mark( id );
+    _parents[id] = from;
+    _distances[id] = id == from ? 0 : _distances[from] + 1;
     ++_count;
 
     // log activity
-    if ( _trace )
-      _out << indentString(vq.size()) << id << " push\n";
+    _tracer.push( _queue.size() - head, id );
 
-    vq.push( id );
+    _queue.push_back( id );
   }
 
   /// All the bookkeeping needed to get a vertex for processing
-  V_ID getNextVisitedVertex( VertexQueue& vq ) const
+  V_ID getNextVisitedVertex( size_t& head )
   {
-    V_ID ret = vq.front();
-    vq.pop();
+    V_ID ret = _queue[head++];
 
     // log activity
-    if ( _trace )
-      _out << indentString(vq.size()) << ret << " pop\n";
+    _tracer.pop( _queue.size() - head, ret );
 
     return ret;
   }
 
   /// Check all the vertices adjacent to the current vertex
-  void checkAdjacent( VertexQueue& vq, V_ID const id )
+  void checkAdjacent( size_t const head, V_ID const from, V_ID const id )
   {
-    if ( _trace )
-      _out << indentString(vq.size()) << "(" << id << ")\n";
+    _tracer.examine( _queue.size() - head, id );
 
     // if the adjacent is marked, ignore it
     // otherwise, mark it and add it to the back of the queue
-    if ( !_marks[id] )
-      visitVertex( vq, id );
+    if ( !_marks.marked(id) )
+      visitVertex( head, from, id );
   }
 
-  inline static std::string indentString( size_t count )
-  {
-    return std::string( count*TAB_SIZE, ' ' );
-  }
-
-  std::vector<bool> _marks;
+  G const& _graph;
+  EpochMarks _marks;
+  std::vector<V_ID> _parents;
+  std::vector<V_ID> _distances;
+  std::vector<V_ID> _queue;
 
   size_t _count;
-  bool _trace;
-  std::ostream& _out;
-
-  static const size_t TAB_SIZE = 2;
+  Tracer _tracer;
 };
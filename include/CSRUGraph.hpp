@@ -0,0 +1,128 @@
+/** \file CSRUGraph.hpp
+ * Immutable undirected graph stored in compressed sparse row form.
+ * Based on Sedgewick and Wayne, 4th ed.
+ *
+ * \author Brian Heim
+ * \date   2026-10-17
+ */
+
+#pragma once
+
+#include "AbstractUGraph.hpp"
+
+#include <cstddef> // size_t
+#include <istream> // istream
+#include <memory> // shared_ptr
+#include <stdexcept> // logic_error
+#include <vector> // vector
+#include <ostream> // ostream
+
+/// Read-only undirected graph using a compressed sparse row layout.
+///
+/// All adjacency lists live back to back in one neighbor array, and
+/// `offsets[v]` .. `offsets[v+1]` delimits the list of vertex `v`. The
+/// arrays are shared between copies, so passing the graph by value is cheap.
+/// They are either owned by the graph or a view into memory kept alive by
+/// an owner object, such as a mapped binary graph file.
+class CSRUGraph : public AbstractUGraph
+{
+public:
+  //--------- Types ----------//
+
+  typedef std::vector<size_type> OffsetArray;
+  typedef std::vector<VertexID> NeighborArray;
+  typedef VertexSpan NeighborRange;
+
+  //--------- Constructors --------//
+
+  /// copy constructor from any other graph, preserving adjacency order
+  explicit CSRUGraph( AbstractUGraph const& graph );
+
+  /// input stream constructor
+  CSRUGraph( std::istream & in );
+
+  /// edge list constructor; adjacency order matches adding `edges` in order
+  /// to an `ALUGraph`. Throws `std::out_of_range` on an invalid vertex.
+  CSRUGraph( size_type const vertex_count, EdgeList const& edges );
+
+  /// edge list constructor for edges split over several buffers, taken in order
+  CSRUGraph( size_type const vertex_count, std::vector<EdgeList> const& edge_chunks );
+
+  /// view constructor; uses `offsets` (`vertex_count + 1` entries) and
+  /// `neighbors` in place, and holds `owner` for as long as any copy lives
+  CSRUGraph( std::shared_ptr<void const> owner,
+             size_type const* offsets, VertexID const* neighbors,
+             size_type const vertex_count, size_type const edge_count );
+
+  //--------- Accessors ---------//
+
+  /// Number of vertices
+  size_type v() const { return _vertex_count; }
+
+  /// Number of edges
+  size_type e() const { return _edge_count; }
+
+  /// Vertices adjacent to the given vertex
+  AdjacencyList verticesAdjacentTo( VertexID const v ) const
+  {
+    return AdjacencyList( _neighbors + _offsets[v], _neighbors + _offsets[v+1] );
+  }
+
+  /// Non-owning range over the vertices adjacent to `v`
+  NeighborRange neighbors( VertexID const v ) const
+  {
+    return NeighborRange( _neighbors + _offsets[v], _neighbors + _offsets[v+1] );
+  }
+
+  /// Degree of vertex `v`; a self-loop is counted twice.
+  size_type degree( VertexID const v ) const
+  {
+    return _offsets[v+1] - _offsets[v];
+  }
+
+  /// The raw offsets array, `v() + 1` entries
+  size_type const* offsetData() const { return _offsets; }
+
+  /// The raw neighbor array, `neighborCount()` entries
+  VertexID const* neighborData() const { return _neighbors; }
+
+  /// Total length of all adjacency lists
+  size_type neighborCount() const { return _offsets[_vertex_count]; }
+
+  //--------- Mutators ---------//
+
+  /// Always throws `std::logic_error`; this graph is immutable.
+  void addEdge( VertexID const, VertexID const )
+  {
+    throw std::logic_error( "CSRUGraph is immutable" );
+  }
+
+private:
+
+  /// Owning storage for the two arrays
+  struct Storage
+  {
+    OffsetArray offsets;
+    NeighborArray neighbors;
+  };
+
+  /// Builds the arrays for `vertex_count` vertices from `chunk_count` edge lists
+  void buildFromEdges( size_type const vertex_count, EdgeList const* chunks, size_t const chunk_count );
+
+  /// Points the raw array pointers at `storage` and takes shared ownership
+  void adopt( std::shared_ptr<Storage const> storage, size_type const edge_count );
+
+  std::shared_ptr<void const> _storage; ///< keeps the arrays alive
+  size_type const* _offsets;
+  VertexID const* _neighbors;
+  size_type _vertex_count;
+  size_type _edge_count;
+
+};
+
+/// Output stream operator
+inline std::ostream& operator<<( std::ostream& os, CSRUGraph const& graph )
+{
+  os << graph.toString();
+  return os;
+}
@@ -0,0 +1,230 @@
+/** \file CompressedUGraph.hpp
+ * Immutable undirected graph with gap- and varint-encoded adjacency lists.
+ *
+ * \author Brian Heim
+ * \date   2026-10-17
+ */
+
+#pragma once
+
+#include "AbstractUGraph.hpp"
+#include "CSRUGraph.hpp"
+
+#include <cstddef> // size_t
+#include <cstdint> // uint8_t, uint32_t, uint64_t
+#include <istream> // istream
+#include <iterator> // forward_iterator_tag
+#include <memory> // shared_ptr
+#include <stdexcept> // logic_error
+#include <vector> // vector
+#include <ostream> // ostream
+
+/// Read-only undirected graph storing each adjacency list sorted and
+/// delta-encoded as LEB128 varints.
+///
+/// The list of vertex `v` starts at byte `offsets[v]` with its degree as a
+/// varint. Lists longer than `BLOCK_SIZE` then carry a skip table with one
+/// entry per block after the first: the neighbor preceding the block and the
+/// block's byte offset. The neighbors follow, each stored as its gap from
+/// the previous one (the first as its gap from zero). Traversal decodes one
+/// gap per neighbor; `hasEdge` uses the skip table to decode at most one
+/// block.
+///
+/// Neighbors come out in ascending order, and a self-loop is listed twice
+/// as in `CSRUGraph`. The storage is shared between copies, so passing the
+/// graph by value is cheap.
+class CompressedUGraph : public AbstractUGraph
+{
+public:
+  //--------- Types ----------//
+
+  typedef std::uint8_t Byte;
+
+  /// Neighbors per block; one skip entry is stored per block after the first
+  static constexpr size_type BLOCK_SIZE = 64;
+
+  /// Bytes in one skip entry: a vertex ID and a 32-bit byte offset
+  static constexpr size_type SKIP_ENTRY_BYTES = sizeof(VertexID) + sizeof(std::uint32_t);
+
+  /// Non-owning range decoding one adjacency list
+  class NeighborRange
+  {
+  public:
+    /// Forward iterator decoding one gap per step
+    class const_iterator
+    {
+    public:
+      typedef std::forward_iterator_tag iterator_category;
+      typedef VertexID value_type;
+      typedef std::ptrdiff_t difference_type;
+      typedef VertexID const* pointer;
+      typedef VertexID reference;
+
+      const_iterator( Byte const* data, size_type const remaining ) :
+        _data(data), _remaining(remaining), _value(0)
+      {
+        if ( _remaining )
+          _value = decodeVarint( _data );
+      }
+
+      VertexID operator*() const { return _value; }
+
+      const_iterator& operator++()
+      {
+        if ( --_remaining )
+          _value += decodeVarint( _data );
+        return *this;
+      }
+
+      const_iterator operator++( int ) { const_iterator it = *this; ++*this; return it; }
+
+      /// Only iterators over the same list may be compared
+      bool operator==( const_iterator const& other ) const { return _remaining == other._remaining; }
+      bool operator!=( const_iterator const& other ) const { return !(*this == other); }
+
+    private:
+      Byte const* _data;     ///< next gap to decode
+      size_type _remaining;  ///< neighbors left, including the current one
+      VertexID _value;
+    };
+    typedef const_iterator iterator;
+
+    NeighborRange( Byte const* data, size_type const size ) : _data(data), _size(size) { }
+
+    const_iterator begin() const { return const_iterator( _data, _size ); }
+    const_iterator end() const   { return const_iterator( nullptr, 0 ); }
+    size_type size() const       { return _size; }
+    bool empty() const           { return _size == 0; }
+
+  private:
+    Byte const* _data;
+    size_type _size;
+  };
+
+  //--------- Constructors --------//
+
+  /// Encodes `graph` using `thread_count` threads; 0 means one per hardware thread
+  explicit CompressedUGraph( CSRUGraph const& graph, size_t const thread_count = 0 );
+
+  /// Encodes any other graph by way of a `CSRUGraph`
+  explicit CompressedUGraph( AbstractUGraph const& graph );
+
+  /// input stream constructor
+  CompressedUGraph( std::istream & in );
+
+  //--------- Accessors ---------//
+
+  /// Number of vertices
+  size_type v() const { return _vertex_count; }
+
+  /// Number of edges
+  size_type e() const { return _edge_count; }
+
+  /// Vertices adjacent to the given vertex, in ascending order
+  AdjacencyList verticesAdjacentTo( VertexID const v ) const
+  {
+    NeighborRange const range = neighbors( v );
+    AdjacencyList adj_list;
+    adj_list.reserve( range.size() );
+    adj_list.assign( range.begin(), range.end() );
+    return adj_list;
+  }
+
+  /// Non-owning range over the vertices adjacent to `v`, in ascending order
+  NeighborRange neighbors( VertexID const v ) const
+  {
+    Byte const* data = list( v );
+    size_type const degree = decodeVarint( data );
+    return NeighborRange( data + skipEntryCount( degree ) * SKIP_ENTRY_BYTES, degree );
+  }
+
+  /// Degree of vertex `v`; a self-loop is counted twice.
+  size_type degree( VertexID const v ) const
+  {
+    Byte const* data = list( v );
+    return decodeVarint( data );
+  }
+
+  /// Whether there is an edge between `v` and `w`
+  bool hasEdge( VertexID const v, VertexID const w ) const;
+
+  /// Bytes used by the encoded lists and their offsets
+  size_type byteSize() const
+  {
+    return (_vertex_count + 1) * sizeof(size_type) + _offsets[_vertex_count];
+  }
+
+  //--------- Mutators ---------//
+
+  /// Always throws `std::logic_error`; this graph is immutable.
+  void addEdge( VertexID const, VertexID const )
+  {
+    throw std::logic_error( "CompressedUGraph is immutable" );
+  }
+
+  //--------- Encoding ---------//
+
+  /// Decodes the varint at `data` and advances past it
+  static std::uint64_t decodeVarint( Byte const*& data )
+  {
+    std::uint64_t byte = *data++;
+    if ( byte < 0x80 )
+      return byte;
+
+    std::uint64_t value = byte & 0x7f;
+    unsigned shift = 7;
+    do {
+      byte = *data++;
+      value |= (byte & 0x7f) << shift;
+      shift += 7;
+    } while ( byte & 0x80 );
+    return value;
+  }
+
+  /// Appends `value` to `out` as a varint
+  static void encodeVarint( std::uint64_t value, std::vector<Byte>& out )
+  {
+    while ( value >= 0x80 ) {
+      out.push_back( Byte(value | 0x80) );
+      value >>= 7;
+    }
+    out.push_back( Byte(value) );
+  }
+
+private:
+
+  typedef std::vector<size_type> OffsetArray;
+  typedef std::vector<Byte> ByteArray;
+
+  /// Owning storage for the offsets and encoded lists
+  struct Storage
+  {
+    OffsetArray offsets;
+    ByteArray bytes;
+  };
+
+  /// Skip entries stored for a list of `degree` neighbors
+  static size_type skipEntryCount( size_type const degree )
+  {
+    return degree > BLOCK_SIZE ? (degree - 1) / BLOCK_SIZE : 0;
+  }
+
+  /// Appends the encoding of the sorted list [first, last) to `out`
+  static void encodeList( VertexID const* first, VertexID const* last, ByteArray& out );
+
+  Byte const* list( VertexID const v ) const { return _bytes + _offsets[v]; }
+
+  std::shared_ptr<Storage const> _storage; ///< keeps the arrays alive
+  size_type const* _offsets;
+  Byte const* _bytes;
+  size_type _vertex_count;
+  size_type _edge_count;
+
+};
+
+/// Output stream operator
+inline std::ostream& operator<<( std::ostream& os, CompressedUGraph const& graph )
+{
+  os << graph.toString();
+  return os;
+}
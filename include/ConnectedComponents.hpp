@@ -19,7 +19,7 @@ public:
   typedef typename G::size_type size_type;
 
   /// Find the connected components of the graph
-  ConnectedComponents( G g, bool traceProgress, std::ostream& os ) :
+  ConnectedComponents( G const& g, bool traceProgress, std::ostream& os ) :
     _marks(g.v(), false),
     _ids(g.v(), 0),
     _count(0),
@@ -37,48 +37,42 @@ public:
   }
 
   /// Returns whether the `source` connected to `target`
-  bool connected( V_ID source, V_ID target ) { return _ids[source] == _ids[target]; }
+  bool connected( V_ID source, V_ID target ) const { return _ids[source] == _ids[target]; }
 
   /// Returns the number of separate components in the graph
-  size_type count() { return _count; }
+  size_type count() const { return _count; }
 
   /// Returns the ID of the given vertex
-  size_type id( V_ID vertex ) { return _ids[vertex]; }
+  size_type id( V_ID vertex ) const { return _ids[vertex]; }
 
 private:
 
-  /// Basic depth first search that marks vertices with visits and component IDs
-  void depthFirstSearch( G& g, V_ID source )
-  {
-    _marks[source] = true;
-    _ids[source] = _count;
-    for ( auto const& vertex : g.verticesAdjacentTo(source) )
-      if ( !_marks[vertex] )
-        depthFirstSearch( g, vertex );
-  }
-
   /// Basic breadth first search that marks vertices with visits and component IDs
-  void breadthFirstSearch( G& g, V_ID source )
+  void breadthFirstSearch( G const& g, V_ID source )
   {
     // create an empty vertex queue
     std::queue<V_ID> vertexQueue;
 
+    // mark vertices as they are queued, so each is queued only once
+    _marks[source] = true;
+    _ids[source] = _count;
     vertexQueue.push( source );
     while ( !vertexQueue.empty() ) {
       V_ID nextVertex = vertexQueue.front();
       vertexQueue.pop();
 
-      _marks[nextVertex] = true;
-      _ids[nextVertex] = _count;
-
-      for ( auto const& adjacentVertex : g.verticesAdjacentTo(nextVertex) )
-        if ( !_marks[adjacentVertex] )
+      for ( auto const adjacentVertex : g.neighbors(nextVertex) ) {
+        if ( !_marks[adjacentVertex] ) {
+          _marks[adjacentVertex] = true;
+          _ids[adjacentVertex] = _count;
           vertexQueue.push( adjacentVertex );
+        }
+      }
     }
   }
 
   std::vector<bool> _marks;
-  std::vector<int> _ids;
+  std::vector<V_ID> _ids;
   size_type _count;
   bool _trace;
   std::ostream& _out;
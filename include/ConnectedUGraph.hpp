@@ -0,0 +1,47 @@
+/** \file ConnectedUGraph.hpp
+  * A mutable graph that keeps its connectivity up to date.
+  *
+  * \author Brian Heim
+  * \date   2026-10-17
+  */
+
+#pragma once
+
+#include "IncrementalConnectivity.hpp"
+
+#include <istream> // istream
+
+/// Graph `G` (`ALUGraph` or `AMUGraph`) whose `addEdge` also updates an
+/// `IncrementalConnectivity`, so connectivity questions can be asked at any
+/// time without rebuilding `ConnectedComponents`. Edges added through an
+/// `AbstractUGraph&` are tracked too.
+template<class G> class ConnectedUGraph : public G
+{
+public:
+  typedef typename G::VertexID VertexID;
+  typedef typename G::size_type size_type;
+
+  /// `size` vertices and no edges
+  explicit ConnectedUGraph( size_type const size ) : G(size), _connectivity(size) { }
+
+  /// input stream constructor
+  explicit ConnectedUGraph( std::istream& in ) : G(in), _connectivity(G::v())
+  {
+    // G's constructor added the edges without us seeing them
+    _connectivity.addEdgesOf( static_cast<G const&>(*this) );
+  }
+
+  /// Connectivity of the edges added so far
+  IncrementalConnectivity const& connectivity() const { return _connectivity; }
+
+  /// Creates an edge between the two named vertices and records it.
+  void addEdge( VertexID const v, VertexID const w )
+  {
+    G::addEdge( v, w );
+    _connectivity.addEdge( v, w );
+  }
+
+private:
+
+  IncrementalConnectivity _connectivity;
+};
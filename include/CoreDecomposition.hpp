@@ -0,0 +1,104 @@
+/** \file CoreDecomposition.hpp
+  * k-core decomposition by bucketed peeling.
+  *
+  * \author Brian Heim
+  * \date   2026-10-17
+  */
+
+#pragma once
+
+#include <algorithm> // max
+#include <cstddef> // size_t
+#include <utility> // swap
+#include <vector>
+
+/// Core number of every vertex in O(V + E), after Batagelj and Zaversnik.
+///
+/// The k-core is the largest subgraph in which every vertex has at least k
+/// neighbors, and a vertex's core number is the largest k whose core holds
+/// it. Vertices are kept sorted by remaining degree in one array of
+/// buckets. Taking them from the front and moving each neighbor down one
+/// bucket with a single swap peels the graph from the outside in.
+///
+/// The order vertices are peeled in is a degeneracy ordering: each vertex
+/// has at most `degeneracy()` neighbors after it. Self-loops are ignored,
+/// and parallel edges count once per copy.
+template<class G> class CoreDecomposition
+{
+public:
+  typedef typename G::VertexID V_ID;
+  typedef typename G::size_type size_type;
+
+  /// Peel every vertex of `g`
+  explicit CoreDecomposition( G const& g ) :
+    _cores(g.v(), 0),
+    _order(g.v()),
+    _positions(g.v()),
+    _degeneracy(0)
+  {
+    size_type const vertex_count = g.v();
+    V_ID max_degree = 0;
+    for ( V_ID v = 0; v < vertex_count; ++v ) {
+      _cores[v] = loopFreeDegree( g, v );
+      max_degree = std::max( max_degree, _cores[v] );
+    }
+
+    // bucket d of `_order` starts at `starts[d]`; counting sort by degree
+    std::vector<size_type> starts( size_type(max_degree) + 2, 0 );
+    for ( V_ID v = 0; v < vertex_count; ++v )
+      ++starts[_cores[v] + 1];
+    for ( size_t d = 1; d < starts.size(); ++d )
+      starts[d] += starts[d - 1];
+    std::vector<size_type> next( starts.begin(), starts.end() - 1 );
+    for ( V_ID v = 0; v < vertex_count; ++v ) {
+      _positions[v] = next[_cores[v]]++;
+      _order[_positions[v]] = v;
+    }
+
+    // `_cores` holds remaining degrees until a vertex is peeled, when its
+    // remaining degree is its core number
+    for ( size_type i = 0; i < vertex_count; ++i ) {
+      V_ID const v = _order[i];
+      _degeneracy = std::max( _degeneracy, _cores[v] );
+      for ( auto const u : g.neighbors(v) ) {
+        if ( _cores[u] <= _cores[v] )
+          continue;
+        // swap u to the front of its bucket, then shrink the bucket past it
+        V_ID const d = _cores[u];
+        V_ID const first = _order[starts[d]];
+        std::swap( _order[_positions[u]], _order[starts[d]] );
+        std::swap( _positions[u], _positions[first] );
+        ++starts[d];
+        --_cores[u];
+      }
+    }
+  }
+
+  /// Core number of `v`
+  V_ID core( V_ID v ) const { return _cores[v]; }
+
+  /// Largest core number
+  V_ID degeneracy() const { return _degeneracy; }
+
+  /// Vertices in the order they were peeled, by nondecreasing core number
+  std::vector<V_ID> const& order() const { return _order; }
+
+  /// Position of `v` in `order()`
+  size_type position( V_ID v ) const { return _positions[v]; }
+
+private:
+
+  /// Neighbors of `v` other than itself, counted with multiplicity
+  static V_ID loopFreeDegree( G const& g, V_ID const v )
+  {
+    V_ID degree = 0;
+    for ( auto const w : g.neighbors(v) )
+      degree += w != v;
+    return degree;
+  }
+
+  std::vector<V_ID> _cores;
+  std::vector<V_ID> _order;
+  std::vector<size_type> _positions;
+  V_ID _degeneracy;
+};
@@ -7,96 +7,115 @@
 
 #pragma once
 
+#include "EpochMarks.hpp"
+#include "SearchTracer.hpp"
+
 #include <vector>
-#include <stack>
-#include <ostream>
 
-template<class G> class DepthFirstSearch
+/// Depth-first search, usable as a workspace for many searches.
+///
+/// Like `BreadthFirstSearch`, it binds to the graph by reference, which
+/// must outlive it, keeps its buffers between calls to `search` and reports
+/// each step to `Tracer`. Every reached neighbor is pushed at once, so the
+/// visit order is not a true depth-first order; `DepthFirstTraversal` gives
+/// one.
+template<class G, class Tracer = NullTracer> class DepthFirstSearch
 {
 public:
   typedef typename G::VertexID V_ID;
-  typedef std::stack<V_ID> VertexStack;
 
-  /// Find vertices connected to source vertex `s`
-  DepthFirstSearch( G g, V_ID s, bool traceProgress, std::ostream& os ) :
-    _marks(g.v(), false),
+  /// Workspace for searches of `g`; call `search` for each source
+  explicit DepthFirstSearch( G const& g, Tracer const tracer = Tracer() ) :
+    _graph(g),
+    _marks(g.v()),
+    _parents(g.v()),
+    _stack(),
     _count(0),
-    _trace(traceProgress),
-    _out(os)
+    _tracer(tracer)
+  { }
+
+  /// Find vertices connected to source vertex `s`
+  DepthFirstSearch( G const& g, V_ID s, Tracer const tracer = Tracer() ) :
+    DepthFirstSearch( g, tracer )
+  {
+    search( s );
+  }
+
+  /// Forget the previous search and find vertices connected to `s`
+  void search( V_ID s )
   {
-    // create a stack of vertices to explore
-    VertexStack vertex_stack;
+    _marks.reset();
+    _count = 0;
+    _tracer.begin( s );
+    _stack.clear();
 
     // visit the source
-    visitVertex( vertex_stack, s );
+    visitVertex( s, s );
 
-    while ( !vertex_stack.empty() ) {
+    while ( !_stack.empty() ) {
 
-      // get the front item off the queue
-      const V_ID current_vertex = getNextVisitedVertex( vertex_stack );
+      // get the top item off the stack
+      const V_ID current_vertex = getNextVisitedVertex();
 
       // for each of that vertex's adjacents
-      for ( auto const adj_vertex : g.verticesAdjacentTo(current_vertex) )
-        checkAdjacent( vertex_stack, adj_vertex );
+      for ( auto const adj_vertex : _graph.neighbors(current_vertex) )
+        checkAdjacent( current_vertex, adj_vertex );
     }
   }
 
   /// Is `v` connected to the source vertex?
-  bool marked( V_ID v ) const { return _marks[v]; }
+  bool marked( V_ID v ) const { return _marks.marked(v); }
 
   /// How many vertices are connected to the source?
   size_t count() const { return _count; }
 
+  /// Vertex that `v` was first reached from; the source is its own parent.
+  /// Only meaningful if `v` is marked.
+  V_ID parent( V_ID v ) const { return _parents[v]; }
+
 private:
 
   /// ALl bookkeeping needed to remember a vertex for later processing
-  void visitVertex( VertexStack& vs, V_ID const id )
+  void visitVertex( V_ID const from, V_ID const id )
   {
-    _marks[id] = true;
+    _marks.mark( id );
+    _parents[id] = from;
     ++_count;
 
     // log activity
-    if ( _trace )
-      _out << indentString(vs.size()) << id << " push\n";
+    _tracer.push( _stack.size(), id );
 
-    vs.push( id );
+    _stack.push_back( id );
   }
 
   /// All the bookkeeping needed to get a vertex for processing
-  V_ID getNextVisitedVertex( VertexStack& vs ) const
+  V_ID getNextVisitedVertex()
   {
-    V_ID ret = vs.top();
-    vs.pop();
+    V_ID ret = _stack.back();
+    _stack.pop_back();
 
     // log activity
-    if ( _trace )
-      _out << indentString(vs.size()) << ret << " pop\n";
+    _tracer.pop( _stack.size(), ret );
 
     return ret;
   }
 
   /// Check all the vertices adjacent to the current vertex
-  void checkAdjacent( VertexStack& vs, V_ID const id )
+  void checkAdjacent( V_ID const from, V_ID const id )
   {
-    if ( _trace )
-      _out << indentString(vs.size()) << "(" << id << ")\n";
+    _tracer.examine( _stack.size(), id );
 
     // if the adjacent is marked, ignore it
-    // otherwise, mark it and add it to the back of the queue
-    if ( !_marks[id] )
-      visitVertex( vs, id );
-  }
-
-  inline static std::string indentString( size_t count )
-  {
-    return std::string( count*TAB_SIZE, ' ' );
+    // otherwise, mark it and add it to the top of the stack
+    if ( !_marks.marked(id) )
+      visitVertex( from, id );
   }
 
-  std::vector<bool> _marks;
+  G const& _graph;
+  EpochMarks _marks;
+  std::vector<V_ID> _parents;
+  std::vector<V_ID> _stack;
 
   size_t _count;
-  bool _trace;
-  std::ostream& _out;
-
-  static const size_t TAB_SIZE = 2;
+  Tracer _tracer;
 };
@@ -0,0 +1,133 @@
+/** \file DepthFirstTraversal.hpp
+  * Depth-first traversal with an explicit stack, recording visit times.
+  *
+  * \author Brian Heim
+  * \date   2026-10-17
+  */
+
+#pragma once
+
+#include <cstddef> // size_t
+#include <limits> // numeric_limits
+#include <vector>
+
+/// True depth-first traversal of a whole graph, one tree per component.
+///
+/// Each stack frame keeps a cursor into its vertex's neighbors, so a vertex
+/// is expanded one edge at a time exactly as a recursive search would, but
+/// the depth of the search is bounded by memory rather than the call stack.
+/// Roots are taken in vertex order.
+///
+/// For every vertex it records preorder and postorder numbers, the tree
+/// parent, and the low-link: the smallest preorder number reachable from
+/// the vertex's subtree through one non-tree edge. Of several edges back to
+/// the parent only the first is the tree edge, so parallel edges count as
+/// back edges and low-links stay right on multigraphs.
+template<class G> class DepthFirstTraversal
+{
+public:
+  typedef typename G::VertexID V_ID;
+  typedef typename G::size_type size_type;
+
+  /// Parent of a root
+  static constexpr V_ID NO_PARENT = std::numeric_limits<V_ID>::max();
+
+  /// Traverse every component of `g`
+  explicit DepthFirstTraversal( G const& g ) :
+    _pre(g.v(), UNVISITED),
+    _post(g.v()),
+    _low(g.v()),
+    _parents(g.v(), NO_PARENT),
+    _preorder(),
+    _root_count(0)
+  {
+    _preorder.reserve( g.v() );
+    std::vector<Frame> stack;
+    V_ID post_count = 0;
+
+    for ( V_ID root = 0; root < g.v(); ++root ) {
+      if ( _pre[root] != UNVISITED )
+        continue;
+      ++_root_count;
+      discover( g, stack, root, NO_PARENT );
+
+      while ( !stack.empty() ) {
+        Frame& frame = stack.back();
+        V_ID const v = frame.vertex;
+
+        if ( frame.cursor == frame.end ) {
+          // v is finished: pass its low-link up to its parent
+          _post[v] = post_count++;
+          stack.pop_back();
+          if ( _parents[v] != NO_PARENT && _low[v] < _low[_parents[v]] )
+            _low[_parents[v]] = _low[v];
+          continue;
+        }
+
+        V_ID const w = *frame.cursor;
+        ++frame.cursor;
+        if ( w == _parents[v] && !frame.passed_parent ) {
+          // the tree edge, seen from below
+          frame.passed_parent = true;
+        } else if ( _pre[w] == UNVISITED ) {
+          // `frame` is invalidated here
+          discover( g, stack, w, v );
+        } else if ( _pre[w] < _low[v] ) {
+          _low[v] = _pre[w];
+        }
+      }
+    }
+  }
+
+  /// Position of `v` in the order vertices were first reached
+  V_ID preorder( V_ID v ) const { return _pre[v]; }
+
+  /// Position of `v` in the order vertices were finished
+  V_ID postorder( V_ID v ) const { return _post[v]; }
+
+  /// Smallest preorder number reachable from the subtree of `v` through at
+  /// most one back edge
+  V_ID low( V_ID v ) const { return _low[v]; }
+
+  /// Tree parent of `v`, or `NO_PARENT` for a root
+  V_ID parent( V_ID v ) const { return _parents[v]; }
+
+  /// Vertices in preorder
+  std::vector<V_ID> const& preorderVertices() const { return _preorder; }
+
+  /// Number of trees, which is the number of connected components
+  size_type rootCount() const { return _root_count; }
+
+private:
+
+  typedef typename G::NeighborRange::const_iterator NeighborIterator;
+
+  static constexpr V_ID UNVISITED = std::numeric_limits<V_ID>::max();
+
+  /// A vertex on the stack and how far its neighbors have been explored
+  struct Frame
+  {
+    V_ID vertex;
+    NeighborIterator cursor;
+    NeighborIterator end;
+    bool passed_parent; ///< whether the tree edge to the parent was skipped
+  };
+
+  void discover( G const& g, std::vector<Frame>& stack, V_ID const v, V_ID const parent )
+  {
+    _pre[v] = _low[v] = _preorder.size();
+    _parents[v] = parent;
+    _preorder.push_back( v );
+
+    auto const neighbors = g.neighbors( v );
+    stack.push_back( Frame{ v, neighbors.begin(), neighbors.end(), false } );
+  }
+
+  // preorder numbers are below the vertex count, so they fit in a V_ID
+  std::vector<V_ID> _pre;
+  std::vector<V_ID> _post;
+  std::vector<V_ID> _low;
+  std::vector<V_ID> _parents;
+  std::vector<V_ID> _preorder;
+  size_type _root_count;
+};
@@ -0,0 +1,231 @@
+/** \file Diameter.hpp
+  * Exact diameter of each connected component by iFUB.
+  *
+  * \author Brian Heim
+  * \date   2026-10-17
+  */
+
+#pragma once
+
+#include "BreadthFirstSearch.hpp"
+#include "ThreadPool.hpp"
+
+#include <algorithm> // max_element, min
+#include <cstddef> // size_t
+#include <limits> // numeric_limits
+#include <memory> // unique_ptr
+#include <utility> // pair
+#include <vector>
+
+/// Diameter of every connected component, after the iFUB algorithm of
+/// Crescenzi et al., which usually needs a handful of breadth-first searches
+/// where the naive method needs one per vertex.
+///
+/// For each component a 4-sweep (two double sweeps, each continued from the
+/// middle of the last path) gives a lower bound and a central vertex `u`.
+/// The eccentricities of the vertices farthest from `u` are then taken one
+/// level at a time: every path longer than twice the current level's depth
+/// must end in a level already taken, so the search stops as soon as the
+/// lower bound reaches that. Every search also bounds the eccentricity of
+/// each vertex `v` from above by `ecc(s) + d(s,v)`, as in Takes and Kosters,
+/// and a vertex whose bound can't beat the diameter so far is skipped. The
+/// searches of one level run in parallel, one per worker.
+template<class G> class Diameter
+{
+public:
+  typedef typename G::VertexID V_ID;
+  typedef typename G::size_type size_type;
+  typedef std::pair<V_ID, V_ID> Endpoints;
+  typedef BreadthFirstSearch<G> Search;
+
+  /// Find the diameter of each component of `g`, using the workers of `pool`
+  Diameter( G const& g, ThreadPool& pool ) :
+    _components(g.v(), NO_COMPONENT),
+    _sizes(),
+    _diameters(),
+    _endpoints(),
+    _search_count(0)
+  {
+    // one search per worker, kept between rounds
+    std::vector<std::unique_ptr<Search>> searches( pool.size() );
+    for ( auto& search : searches )
+      search.reset( new Search( g ) );
+    Search& main = *searches[0];
+    std::vector<V_ID> upper( g.v(), UNBOUNDED );
+
+    for ( V_ID representative = 0; representative < g.v(); ++representative ) {
+      if ( _components[representative] != NO_COMPONENT )
+        continue;
+
+      // the first sweep also finds the component
+      size_type const component = _sizes.size();
+      run( main, representative );
+      std::vector<V_ID> const members = main.visitOrder();
+      for ( auto const v : members )
+        _components[v] = component;
+      _sizes.push_back( main.count() );
+      _diameters.push_back( 0 );
+      _endpoints.push_back( Endpoints( representative, main.visitOrder().back() ) );
+      if ( main.count() <= 2 ) {
+        // a vertex alone or an edge: nothing to sweep
+        _diameters[component] = main.count() - 1;
+        continue;
+      }
+
+      bound( upper, members, searches, 1, pool );
+
+      // 4-sweep: r1 -> a1 -> b1, then from the middle r2 of a1..b1 to a2 -> b2
+      V_ID const a1 = main.visitOrder().back();
+      run( main, a1 );
+      improve( component, main );
+      bound( upper, members, searches, 1, pool );
+      V_ID const r2 = middle( main );
+      run( main, r2 );
+      bound( upper, members, searches, 1, pool );
+      V_ID const a2 = main.visitOrder().back();
+      run( main, a2 );
+      improve( component, main );
+      bound( upper, members, searches, 1, pool );
+      V_ID const u = middle( main );
+
+      // the vertices by distance from u
+      run( main, u );
+      improve( component, main );
+      bound( upper, members, searches, 1, pool );
+      std::vector<V_ID> const by_distance = main.visitOrder();
+      std::vector<V_ID> distances( by_distance.size() );
+      for ( size_t i = 0; i < by_distance.size(); ++i )
+        distances[i] = main.distance( by_distance[i] );
+
+      // take the levels from the farthest in, until no longer path can be
+      // left: any path longer than 2(i-1) has an end at distance >= i
+      size_t level_end = by_distance.size();
+      while ( level_end > 0 ) {
+        V_ID const depth = distances[level_end - 1];
+        if ( _diameters[component] >= 2 * size_type(depth) )
+          break;
+        size_t level_begin = level_end;
+        while ( level_begin > 0 && distances[level_begin - 1] == depth )
+          --level_begin;
+
+        eccentricities( component, upper, by_distance, level_begin, level_end, searches, pool );
+        level_end = level_begin;
+        if ( depth == 0 || _diameters[component] > 2 * size_type(depth - 1) )
+          break;
+      }
+    }
+  }
+
+  /// Number of connected components
+  size_type count() const { return _sizes.size(); }
+
+  /// Component of `v`, numbered by smallest vertex like `ConnectedComponents`
+  size_type id( V_ID v ) const { return _components[v]; }
+
+  /// Vertices in component `i`
+  size_type componentSize( size_type i ) const { return _sizes[i]; }
+
+  /// Greatest distance between two vertices of component `i`
+  size_type diameter( size_type i ) const { return _diameters[i]; }
+
+  /// Greatest distance between two connected vertices of the graph
+  size_type diameter() const
+  {
+    return _diameters.empty() ? 0 : *std::max_element( _diameters.begin(), _diameters.end() );
+  }
+
+  /// Two vertices of component `i` at distance `diameter(i)`
+  Endpoints endpoints( size_type i ) const { return _endpoints[i]; }
+
+  /// Breadth-first searches run in all, against one per vertex naively
+  size_type searchCount() const { return _search_count; }
+
+private:
+
+  static constexpr V_ID NO_COMPONENT = std::numeric_limits<V_ID>::max();
+  static constexpr V_ID UNBOUNDED = std::numeric_limits<V_ID>::max();
+
+  /// Vertices per task when bounding eccentricities
+  static constexpr size_t GRAIN = 4096;
+
+  void run( Search& search, V_ID const source )
+  {
+    search.search( source );
+    ++_search_count;
+  }
+
+  /// Raises the lower bound of `component` to the eccentricity of the last
+  /// source of `search`
+  void improve( size_type const component, Search const& search )
+  {
+    V_ID const far = search.visitOrder().back();
+    if ( search.distance( far ) > _diameters[component] ) {
+      _diameters[component] = search.distance( far );
+      _endpoints[component] = Endpoints( search.visitOrder().front(), far );
+    }
+  }
+
+  /// Vertex halfway along the path from the last search's source to its
+  /// farthest vertex
+  static V_ID middle( Search const& search )
+  {
+    V_ID v = search.visitOrder().back();
+    for ( V_ID steps = search.distance( v ) / 2; steps > 0; --steps )
+      v = search.parent( v );
+    return v;
+  }
+
+  /// Eccentricities of `vertices[begin, end)` whose `upper` bounds exceed
+  /// the diameter so far, searched in rounds of one per worker
+  void eccentricities( size_type const component, std::vector<V_ID>& upper,
+                       std::vector<V_ID> const& vertices, size_t const begin, size_t const end,
+                       std::vector<std::unique_ptr<Search>>& searches, ThreadPool& pool )
+  {
+    std::vector<V_ID> sources;
+    size_t next = begin;
+    while ( next < end ) {
+      // the diameter only grows, so a skipped vertex stays skipped
+      sources.clear();
+      while ( sources.size() < searches.size() && next < end ) {
+        V_ID const v = vertices[next++];
+        if ( upper[v] > _diameters[component] )
+          sources.push_back( v );
+      }
+      if ( sources.empty() )
+        break;
+
+      pool.parallelFor( sources.size(), [&]( size_t const task, size_t ) {
+        searches[task]->search( sources[task] );
+      } );
+      _search_count += sources.size();
+      for ( size_t task = 0; task < sources.size(); ++task )
+        improve( component, *searches[task] );
+      bound( upper, vertices, searches, sources.size(), pool );
+    }
+  }
+
+  /// Lowers the `upper` bounds of `members` by the first `round` searches
+  static void bound( std::vector<V_ID>& upper, std::vector<V_ID> const& members,
+                     std::vector<std::unique_ptr<Search>> const& searches,
+                     size_t const round, ThreadPool& pool )
+  {
+    size_t const tasks = (members.size() + GRAIN - 1) / GRAIN;
+    pool.parallelFor( tasks, [&]( size_t const task, size_t ) {
+      size_t const last = std::min( members.size(), (task + 1) * GRAIN );
+      for ( size_t i = task * GRAIN; i < last; ++i ) {
+        V_ID const v = members[i];
+        for ( size_t s = 0; s < round; ++s ) {
+          Search const& search = *searches[s];
+          V_ID const eccentricity = search.distance( search.visitOrder().back() );
+          upper[v] = std::min( upper[v], V_ID(eccentricity + search.distance( v )) );
+        }
+      }
+    } );
+  }
+
+  std::vector<V_ID> _components;
+  std::vector<size_type> _sizes;
+  std::vector<size_type> _diameters;
+  std::vector<Endpoints> _endpoints;
+  size_type _search_count;
+};
@@ -0,0 +1,174 @@
+/** \file DirectionOptimizingBFS.hpp
+  * Breadth-first search that switches between top-down and bottom-up
+  * frontier expansion.
+  *
+  * \author Brian Heim
+  * \date   2026-10-17
+  */
+
+#pragma once
+
+#include "BitKernels.hpp"
+
+#include <algorithm> // fill
+#include <cstddef> // size_t
+#include <vector>
+
+/// Breadth-first search from one source in the style of Beamer et al.
+///
+/// Top-down steps scan the edges of the frontier, like `BreadthFirstSearch`.
+/// Bottom-up steps instead scan the unvisited vertices and stop at the
+/// first neighbor found in the frontier, which is far cheaper once the
+/// frontier holds a large part of the graph. The search goes bottom-up when
+/// the frontier's edges outnumber `1/alpha` of the unexplored edges, and
+/// back to top-down when the frontier holds fewer than `1/beta` of the
+/// vertices. The frontier and visited sets are bitmaps during bottom-up
+/// steps.
+///
+/// Reachability and `count()` match `BreadthFirstSearch` from the same source.
+template<class G> class DirectionOptimizingBFS
+{
+public:
+  typedef typename G::VertexID V_ID;
+  typedef typename G::size_type size_type;
+  typedef BitKernels::Word Word;
+
+  enum class Direction { TopDown, BottomUp };
+
+  /// Switching thresholds
+  struct Thresholds
+  {
+    double alpha = 15; ///< go bottom-up when frontier edges > unexplored edges / alpha
+    double beta = 18;  ///< go top-down when frontier vertices < vertices / beta
+  };
+
+  /// What happened while expanding one level
+  struct LevelStats
+  {
+    size_t depth;              ///< distance of the level's vertices from the source
+    Direction direction;       ///< how the level was expanded
+    size_type frontier_size;   ///< vertices in the level
+    size_type frontier_edges;  ///< sum of the level's degrees
+    size_type edges_examined;  ///< adjacency entries read while expanding it
+  };
+
+  /// Find vertices connected to source vertex `s`
+  DirectionOptimizingBFS( G const& g, V_ID s, Thresholds const thresholds = Thresholds() ) :
+    _visited(BitKernels::wordsFor(g.v()), 0),
+    _count(0),
+    _levels()
+  {
+    size_type const vertex_count = g.v();
+
+    // edges not yet reached from the frontier, counted from both ends
+    size_type unexplored_edges = 0;
+    for ( V_ID v = 0; v < vertex_count; ++v )
+      unexplored_edges += g.degree( v );
+
+    std::vector<V_ID> frontier( 1, s );
+    std::vector<V_ID> next;
+    std::vector<Word> frontier_bits( _visited.size(), 0 );
+    std::vector<Word> next_bits( _visited.size(), 0 );
+    BitKernels::setBit( _visited.data(), s );
+    _count = 1;
+
+    Direction direction = Direction::TopDown;
+    size_type frontier_size = 1;
+    for ( size_t depth = 0; frontier_size > 0; ++depth ) {
+      size_type frontier_edges = 0;
+      if ( direction == Direction::TopDown ) {
+        for ( auto const v : frontier )
+          frontier_edges += g.degree( v );
+      } else {
+        forEachSetBit( frontier_bits, [&]( V_ID const v ) { frontier_edges += g.degree( v ); } );
+      }
+      unexplored_edges -= frontier_edges;
+
+      // pick this level's direction, converting the frontier if it changes
+      if ( direction == Direction::TopDown && frontier_edges > unexplored_edges / thresholds.alpha ) {
+        direction = Direction::BottomUp;
+        std::fill( frontier_bits.begin(), frontier_bits.end(), 0 );
+        for ( auto const v : frontier )
+          BitKernels::setBit( frontier_bits.data(), v );
+      } else if ( direction == Direction::BottomUp && frontier_size < vertex_count / thresholds.beta ) {
+        direction = Direction::TopDown;
+        frontier.clear();
+        forEachSetBit( frontier_bits, [&]( V_ID const v ) { frontier.push_back( v ); } );
+      }
+
+      LevelStats stats = { depth, direction, frontier_size, frontier_edges, 0 };
+      if ( direction == Direction::TopDown ) {
+        next.clear();
+        for ( auto const v : frontier ) {
+          for ( auto const w : g.neighbors(v) ) {
+            ++stats.edges_examined;
+            if ( !BitKernels::testBit( _visited.data(), w ) ) {
+              BitKernels::setBit( _visited.data(), w );
+              next.push_back( w );
+            }
+          }
+        }
+        frontier.swap( next );
+        frontier_size = frontier.size();
+      } else {
+        std::fill( next_bits.begin(), next_bits.end(), 0 );
+        frontier_size = 0;
+        forEachUnvisited( vertex_count, [&]( V_ID const v ) {
+          for ( auto const w : g.neighbors(v) ) {
+            ++stats.edges_examined;
+            if ( BitKernels::testBit( frontier_bits.data(), w ) ) {
+              BitKernels::setBit( next_bits.data(), v );
+              ++frontier_size;
+              break;
+            }
+          }
+        } );
+        // mark the new level only now, so none of it counts as frontier above
+        for ( size_t i = 0; i < _visited.size(); ++i )
+          _visited[i] |= next_bits[i];
+        frontier_bits.swap( next_bits );
+      }
+
+      _count += frontier_size;
+      _levels.push_back( stats );
+    }
+  }
+
+  /// Is `v` connected to the source vertex?
+  bool marked( V_ID v ) const { return BitKernels::testBit( _visited.data(), v ); }
+
+  /// How many vertices are connected to the source?
+  size_t count() const { return _count; }
+
+  /// One entry per level expanded, starting with the source's
+  std::vector<LevelStats> const& levels() const { return _levels; }
+
+private:
+
+  /// Calls `fn(v)` for each vertex whose bit is set in `bits`
+  template<class F>
+  static void forEachSetBit( std::vector<Word> const& bits, F&& fn )
+  {
+    for ( size_t i = 0; i < bits.size(); ++i )
+      for ( Word word = bits[i]; word != 0; word &= word - 1 )
+        fn( V_ID(i * BitKernels::WORD_BITS + BitKernels::countTrailingZeros(word)) );
+  }
+
+  /// Calls `fn(v)` for each of the `vertex_count` vertices not yet visited
+  template<class F>
+  void forEachUnvisited( size_type const vertex_count, F&& fn ) const
+  {
+    for ( size_t i = 0; i < _visited.size(); ++i ) {
+      Word word = ~_visited[i];
+      size_t const base = i * BitKernels::WORD_BITS;
+      if ( vertex_count - base < BitKernels::WORD_BITS )
+        word &= (Word(1) << (vertex_count - base)) - 1;
+      for ( ; word != 0; word &= word - 1 )
+        fn( V_ID(base + BitKernels::countTrailingZeros(word)) );
+    }
+  }
+
+  std::vector<Word> _visited;
+  size_t _count;
+  std::vector<LevelStats> _levels;
+};
@@ -0,0 +1,148 @@
+/** \file EccentricityBounds.hpp
+  * Bounds on the eccentricity of every vertex from a few searches.
+  *
+  * \author Brian Heim
+  * \date   2026-10-17
+  */
+
+#pragma once
+
+#include "BreadthFirstSearch.hpp"
+#include "ThreadPool.hpp"
+
+#include <algorithm> // find, max, min
+#include <cstddef> // size_t
+#include <limits> // numeric_limits
+#include <memory> // unique_ptr
+#include <vector>
+
+/// Lower and upper bounds on every vertex's eccentricity, in the style of
+/// Takes and Kosters.
+///
+/// A search from `s` bounds every vertex `v` of its component:
+/// `max(d(s,v), ecc(s) - d(s,v)) <= ecc(v) <= ecc(s) + d(s,v)`. Each
+/// component gets up to `sources_per_component` searches, taken in rounds
+/// of one per worker and run in parallel. Sources alternate between the
+/// vertices with the largest upper bounds, which tend to be on the
+/// periphery, and those with the smallest lower bounds, which tend to be
+/// central, and a component stops early once all its bounds meet. The
+/// lower bound is the estimate; it is exact for most vertices of typical
+/// graphs, and always for the sources.
+template<class G> class EccentricityBounds
+{
+public:
+  typedef typename G::VertexID V_ID;
+  typedef typename G::size_type size_type;
+  typedef BreadthFirstSearch<G> Search;
+
+  /// Bound the eccentricities of `g`'s vertices, using the workers of `pool`
+  EccentricityBounds( G const& g, ThreadPool& pool, size_t const sources_per_component = 16 ) :
+    _lower(g.v(), 0),
+    _upper(g.v(), UNBOUNDED),
+    _search_count(0)
+  {
+    std::vector<std::unique_ptr<Search>> searches( pool.size() );
+    for ( auto& search : searches )
+      search.reset( new Search( g ) );
+
+    std::vector<bool> assigned( g.v(), false );
+    for ( V_ID representative = 0; representative < g.v(); ++representative ) {
+      if ( assigned[representative] )
+        continue;
+
+      // the first search finds the component and bounds it
+      searches[0]->search( representative );
+      ++_search_count;
+      std::vector<V_ID> const component = searches[0]->visitOrder();
+      for ( auto const v : component )
+        assigned[v] = true;
+      tighten( component, searches, 1, pool );
+
+      size_t taken = 1;
+      bool periphery = true;
+      std::vector<V_ID> sources;
+      while ( taken < sources_per_component ) {
+        // choose this round's sources from the bounds so far
+        sources.clear();
+        while ( sources.size() < searches.size() && taken < sources_per_component ) {
+          V_ID const source = pick( component, sources, periphery );
+          if ( source == NO_VERTEX )
+            break;
+          periphery = !periphery;
+          sources.push_back( source );
+          ++taken;
+        }
+        if ( sources.empty() )
+          break;
+
+        // then search from all of them at once, one search per task
+        pool.parallelFor( sources.size(), [&]( size_t const task, size_t ) {
+          searches[task]->search( sources[task] );
+        } );
+        _search_count += sources.size();
+        tighten( component, searches, sources.size(), pool );
+      }
+    }
+  }
+
+  /// Eccentricity of `v` is at least this
+  V_ID lower( V_ID v ) const { return _lower[v]; }
+
+  /// Eccentricity of `v` is at most this
+  V_ID upper( V_ID v ) const { return _upper[v]; }
+
+  /// Whether the bounds on `v` meet, so `lower(v)` is its eccentricity
+  bool exact( V_ID v ) const { return _lower[v] == _upper[v]; }
+
+  /// Breadth-first searches run in all
+  size_type searchCount() const { return _search_count; }
+
+private:
+
+  static constexpr V_ID UNBOUNDED = std::numeric_limits<V_ID>::max();
+  static constexpr V_ID NO_VERTEX = std::numeric_limits<V_ID>::max();
+
+  /// Vertices per task when tightening bounds
+  static constexpr size_t GRAIN = 4096;
+
+  /// Vertex of `component` whose bounds haven't met and that isn't one of
+  /// the round's `chosen` sources, with the largest upper bound for the
+  /// `periphery`, otherwise with the smallest lower bound. Once searched, a
+  /// source's bounds meet, so it is never picked again.
+  V_ID pick( std::vector<V_ID> const& component, std::vector<V_ID> const& chosen, bool const periphery ) const
+  {
+    V_ID best = NO_VERTEX;
+    for ( auto const v : component ) {
+      if ( exact(v) || std::find( chosen.begin(), chosen.end(), v ) != chosen.end() )
+        continue;
+      if ( best == NO_VERTEX ||
+           (periphery ? _upper[v] > _upper[best] : _lower[v] < _lower[best]) )
+        best = v;
+    }
+    return best;
+  }
+
+  /// Applies the first `round` searches to the bounds of `component`
+  void tighten( std::vector<V_ID> const& component, std::vector<std::unique_ptr<Search>> const& searches,
+                size_t const round, ThreadPool& pool )
+  {
+    size_t const tasks = (component.size() + GRAIN - 1) / GRAIN;
+    pool.parallelFor( tasks, [&]( size_t const task, size_t ) {
+      size_t const end = std::min( component.size(), (task + 1) * GRAIN );
+      for ( size_t i = task * GRAIN; i < end; ++i ) {
+        V_ID const v = component[i];
+        for ( size_t s = 0; s < round; ++s ) {
+          Search const& search = *searches[s];
+          V_ID const eccentricity = search.distance( search.visitOrder().back() );
+          V_ID const d = search.distance( v );
+          _lower[v] = std::max( _lower[v], std::max( d, V_ID(eccentricity - d) ) );
+          _upper[v] = std::min( _upper[v], V_ID(eccentricity + d) );
+        }
+      }
+    } );
+  }
+
+  std::vector<V_ID> _lower;
+  std::vector<V_ID> _upper;
+  size_type _search_count;
+};
@@ -0,0 +1,75 @@
+/** \file EdgeListLoader.hpp
+ * Parallel loader for the edge-list text format written by
+ * `AbstractUGraph::toInputString()`.
+ *
+ * \author Brian Heim
+ * \date   2026-10-17
+ */
+
+#pragma once
+
+#include "AbstractUGraph.hpp"
+#include "CSRUGraph.hpp"
+
+#include <cstddef> // size_t
+#include <string> // string
+#include <vector> // vector
+
+/// Memory-maps an edge-list file and parses it on several threads.
+///
+/// The format is the vertex count and the edge count, one per line,
+/// followed by one `v w` pair per line. The file is split into line-aligned
+/// chunks that are parsed independently; the edges of each chunk are kept
+/// in their own buffer, in file order.
+///
+/// Throws `std::system_error` if the file can't be read, and
+/// `std::runtime_error` naming the file and line on malformed input,
+/// out-of-range vertex IDs or an edge count that doesn't match the header.
+class EdgeListLoader
+{
+public:
+  typedef AbstractUGraph::size_type size_type;
+  typedef AbstractUGraph::EdgeList EdgeList;
+
+  /// Parses `filename` using `thread_count` threads; 0 means one per hardware thread
+  explicit EdgeListLoader( std::string const& filename, size_t const thread_count = 0 );
+
+  /// Number of vertices declared in the header
+  size_type vertexCount() const { return _vertex_count; }
+
+  /// Number of edges read
+  size_type edgeCount() const { return _edge_count; }
+
+  /// Per-chunk edge buffers, in file order
+  std::vector<EdgeList> const& edgeChunks() const { return _chunks; }
+
+  /// Adds every edge to `graph`, in file order
+  template<class G>
+  void addEdgesTo( G& graph ) const
+  {
+    for ( auto const& chunk : _chunks )
+      for ( auto const& edge : chunk )
+        graph.addEdge( edge.first, edge.second );
+  }
+
+  /// Builds a graph of type `G` with the same adjacency order as `G(istream&)`
+  template<class G>
+  G build() const
+  {
+    G graph( _vertex_count );
+    addEdgesTo( graph );
+    return graph;
+  }
+
+private:
+  size_type _vertex_count;
+  size_type _edge_count;
+  std::vector<EdgeList> _chunks;
+};
+
+/// CSRUGraph is immutable, so it is built from the edge buffers directly
+template<>
+inline CSRUGraph EdgeListLoader::build<CSRUGraph>() const
+{
+  return CSRUGraph( _vertex_count, _chunks );
+}
@@ -0,0 +1,45 @@
+/** \file EpochMarks.hpp
+  * Visited set that clears in constant time.
+  *
+  * \author Brian Heim
+  * \date   2026-10-17
+  */
+
+#pragma once
+
+#include <algorithm> // fill
+#include <cstddef> // size_t
+#include <cstdint> // uint32_t
+#include <vector>
+
+/// A set of marks over [0, size) for searches that run many times.
+///
+/// Each slot holds the epoch in which it was last marked, and a slot is
+/// marked when that equals the current epoch. `reset()` just starts a new
+/// epoch, so clearing costs nothing until the 32-bit counter wraps, when
+/// the stamps are zeroed once.
+class EpochMarks
+{
+public:
+  explicit EpochMarks( size_t const size = 0 ) : _stamps(size, 0), _epoch(1) { }
+
+  /// Number of slots
+  size_t size() const { return _stamps.size(); }
+
+  bool marked( size_t const i ) const { return _stamps[i] == _epoch; }
+
+  void mark( size_t const i ) { _stamps[i] = _epoch; }
+
+  /// Unmarks every slot
+  void reset()
+  {
+    if ( ++_epoch == 0 ) {
+      std::fill( _stamps.begin(), _stamps.end(), 0 );
+      _epoch = 1;
+    }
+  }
+
+private:
+  std::vector<std::uint32_t> _stamps;
+  std::uint32_t _epoch;
+};
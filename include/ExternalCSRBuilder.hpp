@@ -0,0 +1,74 @@
+/** \file ExternalCSRBuilder.hpp
+ * Builds a binary CSR graph file from an edge list that may be larger
+ * than memory.
+ *
+ * \author Brian Heim
+ * \date   2026-10-17
+ */
+
+#pragma once
+
+#include "AbstractUGraph.hpp"
+
+#include <cstddef> // size_t
+#include <cstdint> // uint64_t
+#include <functional> // function
+#include <istream> // istream
+#include <string> // string
+#include <utility> // move
+
+/// Two-pass external-memory CSR construction.
+///
+/// The first pass reads the edge list, turns every edge into its two
+/// directed arcs, and fills a buffer of at most the memory budget. Full
+/// buffers are sorted by (source, target) and spilled to unlinked
+/// temporary files. The second pass merges the sorted runs and streams the
+/// offsets and neighbor arrays into a `BinaryGraphFormat` file, whose
+/// adjacency lists come out sorted. If there are more runs than the budget
+/// allows buffers for, runs are merged in several rounds.
+///
+/// Memory use stays within the budget plus a few fixed-size I/O buffers,
+/// whatever the size of the input.
+class ExternalCSRBuilder
+{
+public:
+  typedef AbstractUGraph::VertexID VertexID;
+  typedef AbstractUGraph::size_type size_type;
+
+  /// Snapshot passed to the progress callback
+  struct Progress
+  {
+    enum Phase { Reading, Merging, Done };
+
+    Phase phase;
+    std::uint64_t edges_read;    ///< edges parsed so far
+    std::uint64_t edge_count;    ///< edges declared in the input header
+    std::uint64_t runs;          ///< sorted runs currently on disk
+    std::uint64_t arcs_merged;   ///< arcs written by the current merge round
+    std::uint64_t arcs_total;    ///< arcs in the current merge round
+  };
+
+  typedef std::function<void(Progress const&)> ProgressCallback;
+
+  /// Smallest accepted memory budget
+  static constexpr size_t MIN_MEMORY_BUDGET = 1 << 20;
+
+  /// Creates a builder using about `memory_budget` bytes and placing its
+  /// temporary files in `temp_directory`. Throws `std::invalid_argument`
+  /// if the budget is below `MIN_MEMORY_BUDGET`.
+  ExternalCSRBuilder( size_t const memory_budget, std::string const& temp_directory = "/tmp" );
+
+  /// Calls `callback` periodically while building
+  void setProgressCallback( ProgressCallback callback ) { _progress = std::move( callback ); }
+
+  /// Reads an edge list in the `toInputString()` format from `in` and writes
+  /// the binary graph to `output_filename`. Throws `std::runtime_error` on
+  /// malformed input or out-of-range vertex IDs, and `std::system_error` on
+  /// I/O failure.
+  void build( std::istream& in, std::string const& output_filename );
+
+private:
+  size_t _memory_budget;
+  std::string _temp_directory;
+  ProgressCallback _progress;
+};
@@ -9,11 +9,15 @@
 
 #include "AbstractUGraph.hpp"
 
+#include <algorithm> // find
+#include <memory> // unique_ptr
 #include <random>
+#include <stdexcept> // domain_error
+#include <string> // string, to_string
 #include <istream>
 
-#include <iostream>
-
+/// Adds uniformly random edges to an existing graph one at a time, redrawing
+/// repeats. For whole random graphs, RandomGraphs.hpp is much faster.
 class GraphGenerator
 {
 public:
@@ -106,13 +110,7 @@ protected:
           // Finally add the edge and exit the loop
           _graph->addEdge( v, w );
           break;
-
-        } else {
-          std::clog << "Skipping existing edge: (" << v << ", " << w << ")" << std::endl;
         }
-
-      } else {
-        std::clog << "Skipping self-loop: (" << v << ", " << w << ")" << std::endl;
       }
     }
   }
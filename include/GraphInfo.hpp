@@ -9,12 +9,19 @@
 
 #pragma once
 
+#include "EpochMarks.hpp"
+#include "ThreadPool.hpp"
+
 #include <vector>
 #include <ostream>
 #include <queue>
 #include <stack>
 #include <experimental/optional>
 #include <tuple>
+#include <algorithm> // min, reverse
+#include <atomic>
+#include <limits> // numeric_limits
+#include <mutex>
 
 namespace GraphInfo {
 
@@ -66,7 +73,7 @@ std::experimental::optional<std::vector<typename G::VertexID>> findCycle( G cons
       vertexStack.pop();
 
       // check each of its neighbors
-      for ( auto const neighbor : graph.verticesAdjacentTo(topVertex) ) {
+      for ( auto const neighbor : graph.neighbors(topVertex) ) {
 
         if ( !marks[neighbor] ) {
           // "visit" by marking, recording ancestor, and pushing to the stack
@@ -103,4 +110,191 @@ std::experimental::optional<std::vector<typename G::VertexID>> findCycle( G cons
   }
 }
 
+namespace detail {
+
+/** \brief Joins two vertices of a search tree through their lowest common
+ * ancestor
+ *
+ * \returns the tree path from `u` up to the ancestor and back down to `w`.
+ * If `u` and `w` are adjacent, it is a cycle closed by that edge.
+ */
+template<class V_ID>
+std::vector<V_ID> joinInTree( std::vector<V_ID> const& parents, std::vector<V_ID> const& depths, V_ID u, V_ID w )
+{
+  std::vector<V_ID> path;
+  std::vector<V_ID> wSide;
+  while ( u != w ) {
+    if ( depths[u] >= depths[w] ) {
+      path.push_back( u );
+      u = parents[u];
+    } else {
+      wSide.push_back( w );
+      w = parents[w];
+    }
+  }
+  path.push_back( u );
+  path.insert( path.end(), wSide.rbegin(), wSide.rend() );
+  return path;
+}
+
+} // namespace detail
+
+/** \brief Finds a cycle of odd length if there is one, which is exactly when
+ * the graph is not bipartite
+ *
+ * Two-colors each component by breadth-first search, in linear time. An
+ * edge between two vertices of one color closes an odd cycle through their
+ * common ancestor. A self-loop is an odd cycle of one vertex.
+ *
+ * \returns an optional containing the cycle's vertices in order, the last
+ * adjacent to the first, or nothing if the graph is bipartite.
+ */
+template<class G>
+std::experimental::optional<std::vector<typename G::VertexID>> findOddCycle( G const& graph )
+{
+  typedef typename G::VertexID V_ID;
+  typedef std::vector<V_ID> Path;
+  V_ID const unseen = std::numeric_limits<V_ID>::max();
+
+  // depth in the search tree; its parity is the vertex's color
+  std::vector<V_ID> depths( graph.v(), unseen );
+  std::vector<V_ID> parents( graph.v(), 0 );
+  std::vector<V_ID> queue;
+
+  for ( V_ID root = 0; root < graph.v(); ++root ) {
+    if ( depths[root] != unseen )
+      continue;
+
+    depths[root] = 0;
+    parents[root] = root;
+    queue.assign( 1, root );
+    for ( size_t head = 0; head < queue.size(); ++head ) {
+      V_ID const vertex = queue[head];
+      for ( auto const neighbor : graph.neighbors(vertex) ) {
+        if ( depths[neighbor] == unseen ) {
+          depths[neighbor] = depths[vertex] + 1;
+          parents[neighbor] = vertex;
+          queue.push_back( neighbor );
+        } else if ( depths[neighbor] % 2 == depths[vertex] % 2 ) {
+          return std::experimental::make_optional( detail::joinInTree( parents, depths, vertex, neighbor ) );
+        }
+      }
+    }
+  }
+
+  return std::experimental::optional<Path>();
+}
+
+/// Whether the vertices can be split in two sets with no edge inside either
+template<class G>
+bool isBipartite( G const& graph )
+{
+  return !findOddCycle( graph );
+}
+
+/** \brief Finds a shortest cycle, whose length is the girth of the graph
+ *
+ * Runs a breadth-first search from every vertex of degree two or more on
+ * the workers of `pool`. The search from `root` only enters vertices
+ * numbered at least `root`, so each cycle is found from its smallest
+ * vertex, and it stops at the depth where it could no longer beat the
+ * shortest cycle found by any worker. A self-loop is a cycle of length one
+ * and a repeated edge a cycle of length two.
+ *
+ * \returns an optional containing a shortest cycle of at most `maxLength`
+ * vertices, in order, the last adjacent to the first, or nothing if there
+ * is no such cycle. Which of several shortest cycles is returned depends
+ * on scheduling.
+ */
+template<class G>
+std::experimental::optional<std::vector<typename G::VertexID>> findShortestCycle(
+    G const& graph, ThreadPool& pool,
+    size_t const maxLength = std::numeric_limits<size_t>::max() )
+{
+  typedef typename G::VertexID V_ID;
+  typedef std::vector<V_ID> Path;
+
+  // roots per task
+  size_t const grain = 64;
+
+  // per-worker search state, kept across roots
+  struct Workspace
+  {
+    EpochMarks marks;
+    std::vector<V_ID> depths;
+    std::vector<V_ID> parents;
+    std::vector<V_ID> queue;
+  };
+  std::vector<Workspace> workspaces( pool.size() );
+
+  // length of the shortest cycle found so far, which bounds every search
+  std::atomic<size_t> best( maxLength < std::numeric_limits<size_t>::max() ? maxLength + 1 : maxLength );
+  std::mutex bestMutex;
+  Path bestCycle;
+
+  auto const record = [&]( Workspace const& ws, V_ID const u, V_ID const w ) {
+    Path cycle = detail::joinInTree( ws.parents, ws.depths, u, w );
+    std::lock_guard<std::mutex> lock( bestMutex );
+    if ( cycle.size() < best.load( std::memory_order_relaxed ) ) {
+      best.store( cycle.size(), std::memory_order_relaxed );
+      bestCycle.swap( cycle );
+    }
+  };
+
+  size_t const taskCount = (graph.v() + grain - 1) / grain;
+  pool.parallelFor( taskCount, [&]( size_t const task, size_t const worker ) {
+    Workspace& ws = workspaces[worker];
+    if ( ws.depths.empty() ) {
+      ws.marks = EpochMarks( graph.v() );
+      ws.depths.resize( graph.v() );
+      ws.parents.resize( graph.v() );
+    }
+
+    V_ID const last = std::min<size_t>( graph.v(), (task + 1) * grain );
+    for ( V_ID root = task * grain; root < last; ++root ) {
+      // nothing shorter than a self-loop
+      if ( best.load( std::memory_order_relaxed ) <= 1 )
+        return;
+      if ( graph.degree( root ) < 2 )
+        continue;
+
+      ws.marks.reset();
+      ws.marks.mark( root );
+      ws.depths[root] = 0;
+      ws.parents[root] = root;
+      ws.queue.assign( 1, root );
+      for ( size_t head = 0; head < ws.queue.size(); ++head ) {
+        V_ID const vertex = ws.queue[head];
+
+        // every cycle closed from here has at least 2 * depth + 1 vertices
+        if ( 2 * size_t(ws.depths[vertex]) + 1 >= best.load( std::memory_order_relaxed ) )
+          break;
+
+        bool passedParent = false;
+        for ( auto const neighbor : graph.neighbors(vertex) ) {
+          if ( neighbor < root )
+            continue;
+          if ( neighbor == vertex ) {
+            record( ws, vertex, neighbor );
+          } else if ( neighbor == ws.parents[vertex] && !passedParent ) {
+            // the tree edge, seen from below
+            passedParent = true;
+          } else if ( !ws.marks.marked(neighbor) ) {
+            ws.marks.mark( neighbor );
+            ws.depths[neighbor] = ws.depths[vertex] + 1;
+            ws.parents[neighbor] = vertex;
+            ws.queue.push_back( neighbor );
+          } else if ( size_t(ws.depths[vertex]) + ws.depths[neighbor] + 1 < best.load( std::memory_order_relaxed ) ) {
+            record( ws, vertex, neighbor );
+          }
+        }
+      }
+    }
+  } );
+
+  if ( bestCycle.empty() )
+    return std::experimental::optional<Path>();
+  return std::experimental::make_optional( bestCycle );
+}
+
 } // namespace GraphInfo
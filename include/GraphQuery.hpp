@@ -0,0 +1,100 @@
+/** \file GraphQuery.hpp
+ * Queries about a graph and their answers, as text lines and as compact
+ * binary messages.
+ *
+ * Text, one query per line, answered by one tab-separated line that
+ * repeats the query:
+ *
+ *     reach U          reach      U  COUNT
+ *     connected U V    connected  U  V  0|1
+ *     path U V         path       U  V  EDGES  VERTICES
+ *     cycle            cycle      EDGES  VERTICES
+ *     size             size       VERTEX_COUNT  EDGE_COUNT
+ *
+ * EDGES is -1 and VERTICES empty when there is no path or cycle. A query
+ * that fails is answered by `error  LINE  MESSAGE`.
+ *
+ * Binary, integers as LEB128 varints (low seven bits first):
+ *
+ *     query   kind byte, then U for reach, connected and path, then V
+ *             for connected and path
+ *     answer  status byte (0 ok, 1 error); after an error, the message
+ *             to the end; otherwise, by the kind of query: reach, COUNT;
+ *             connected, a 0 or 1 byte; path and cycle, the number of
+ *             vertices and each vertex; size, VERTEX_COUNT and EDGE_COUNT
+ *
+ * \author Brian Heim
+ * \date   2026-10-17
+ */
+
+#pragma once
+
+#include "AbstractUGraph.hpp"
+
+#include <cstdint> // uint8_t
+#include <ostream>
+#include <string> // string
+#include <vector>
+
+namespace GraphQuery {
+
+typedef AbstractUGraph::VertexID VertexID;
+typedef AbstractUGraph::size_type size_type;
+
+/// What a query asks; the values are the binary kind bytes
+enum class Kind : std::uint8_t
+{
+  Reach = 0,     ///< how many vertices are connected to u
+  Connected = 1, ///< whether u and v are connected
+  Path = 2,      ///< a path from u to v
+  Cycle = 3,     ///< any cycle of the graph
+  Size = 4,      ///< the vertex and edge counts
+};
+
+/// A question about the graph
+struct Query
+{
+  Kind kind;
+  VertexID u; ///< used by reach, connected and path
+  VertexID v; ///< used by connected and path
+};
+
+/// The answer to a query; only the fields of its kind are meaningful
+struct Answer
+{
+  std::string error;              ///< empty unless the query failed
+  size_type reach;                ///< vertices connected to u, u included
+  bool connected;                 ///< whether u and v are connected
+  std::vector<VertexID> vertices; ///< the path from u to v, or the cycle; empty if none
+  size_type vertex_count;
+  size_type edge_count;
+  double seconds;                 ///< time taken to answer; not sent
+};
+
+/// The query on `line`. Throws `std::invalid_argument` if it isn't one.
+Query parse( std::string const& line );
+
+/// Whether `line` holds no query: blank, or a `#` comment
+bool isBlank( std::string const& line );
+
+/// Writes `answer` to `query` as one tab-separated line; an answer with an
+/// error is written as an error on input line `line`
+void write( std::ostream& out, Query const& query, Answer const& answer, size_type const line );
+
+/// Writes the error `message` about input line `line`
+void writeError( std::ostream& out, size_type const line, std::string const& message );
+
+/// Binary form of `query`
+std::string encode( Query const& query );
+
+/// Binary form of `answer` to a query of kind `kind`
+std::string encode( Kind const kind, Answer const& answer );
+
+/// Query from its binary form. Throws `std::runtime_error` if malformed.
+Query decodeQuery( std::string const& message );
+
+/// Answer to a query of kind `kind` from its binary form. Throws
+/// `std::runtime_error` if malformed.
+Answer decodeAnswer( Kind const kind, std::string const& message );
+
+} // namespace GraphQuery
@@ -0,0 +1,165 @@
+/** \file GraphWriter.hpp
+ * Streaming, buffered output of graphs in the text formats.
+ *
+ * \author Brian Heim
+ * \date   2026-10-17
+ */
+
+#pragma once
+
+#include "AbstractUGraph.hpp"
+#include "ThreadPool.hpp"
+
+#include <charconv> // to_chars
+#include <cmath> // log10, ceil
+#include <cstddef> // size_t
+#include <cstdint> // uint64_t
+#include <ostream> // ostream
+#include <string> // string
+#include <vector> // vector
+
+/// Writes a graph as text without building the whole text in memory.
+///
+/// Vertices are cut into chunks of about `CHUNK_ARCS` adjacency entries.
+/// Each round formats one chunk per worker with `std::to_chars` into that
+/// worker's reused buffer, then writes the buffers in vertex order, so peak
+/// memory is a few buffers however large the graph is.
+///
+/// Output goes to a file descriptor or to a stream. Writing to a stream
+/// keeps the order of anything else written to it; a file descriptor skips
+/// the stream's own buffering. Throws `std::system_error` if a descriptor
+/// write fails and `std::runtime_error` if the stream goes bad.
+class GraphWriter
+{
+public:
+  typedef AbstractUGraph::VertexID VertexID;
+  typedef AbstractUGraph::size_type size_type;
+
+  /// Adjacency entries formatted per chunk
+  static constexpr size_type CHUNK_ARCS = 1 << 16;
+
+  /// Writes to the file descriptor `fd`, which stays open, using
+  /// `thread_count` threads; 0 means one per hardware thread
+  explicit GraphWriter( int const fd, size_t const thread_count = 0 );
+
+  /// Writes to `out` using `thread_count` threads
+  explicit GraphWriter( std::ostream& out, size_t const thread_count = 0 );
+
+  /// Writes `graph` in the format of `toInputString()`, which the graph
+  /// constructors and `EdgeListLoader` read back
+  template<class G>
+  void writeEdgeList( G const& graph )
+  {
+    writeChunks( graph, [&]( VertexID const v ) { return graph.neighbors( v ); }, Layout::EdgeList );
+  }
+
+  /// `writeEdgeList` for a graph known only through the base class
+  void writeEdgeList( AbstractUGraph const& graph );
+
+  /// Writes `graph` in the format of `toString()`, one adjacency list per line
+  template<class G>
+  void writeAdjacencyLists( G const& graph )
+  {
+    writeChunks( graph, [&]( VertexID const v ) { return graph.neighbors( v ); }, Layout::AdjacencyLists );
+  }
+
+  /// `writeAdjacencyLists` for a graph known only through the base class
+  void writeAdjacencyLists( AbstractUGraph const& graph );
+
+private:
+
+  enum class Layout { EdgeList, AdjacencyLists };
+
+  /// Formats and writes `graph`; `neighbors_of(v)` returns a range over the
+  /// vertices adjacent to `v`
+  template<class G, class NeighborsOf>
+  void writeChunks( G const& graph, NeighborsOf neighbors_of, Layout const layout )
+  {
+    size_type const vertex_count = graph.v();
+
+    if ( layout == Layout::EdgeList ) {
+      std::string header;
+      appendNumber( header, vertex_count );
+      header += '\n';
+      appendNumber( header, graph.e() );
+      header += '\n';
+      writeBytes( header.data(), header.size() );
+    }
+
+    // same width as toString() uses for the vertex column
+    size_t const field_width = vertex_count ? size_t( std::ceil( std::log10(vertex_count) ) ) : 0;
+
+    std::vector<VertexID> bounds( _pool.size() + 1 );
+    VertexID next = 0;
+    while ( next < vertex_count ) {
+      // cut the next round of chunks; an empty list still costs a line
+      size_t chunk_count = 0;
+      bounds[0] = next;
+      while ( chunk_count < _pool.size() && next < vertex_count ) {
+        size_type arcs = 0;
+        while ( next < vertex_count && arcs < CHUNK_ARCS )
+          arcs += graph.degree( next++ ) + 1;
+        bounds[++chunk_count] = next;
+      }
+
+      _pool.parallelFor( chunk_count, [&]( size_t const chunk, size_t ) {
+        std::string& buffer = _buffers[chunk];
+        buffer.clear();
+        for ( VertexID v = bounds[chunk]; v < bounds[chunk+1]; ++v ) {
+          if ( layout == Layout::EdgeList ) {
+            // each edge once, from its lower endpoint
+            for ( auto const w : neighbors_of(v) ) {
+              if ( w >= v ) {
+                appendNumber( buffer, v );
+                buffer += ' ';
+                appendNumber( buffer, w );
+                buffer += '\n';
+              }
+            }
+          } else {
+            appendPadded( buffer, v, field_width );
+            buffer += " |";
+            for ( auto const w : neighbors_of(v) ) {
+              buffer += ' ';
+              appendNumber( buffer, w );
+            }
+            buffer += '\n';
+          }
+        }
+      } );
+
+      for ( size_t chunk = 0; chunk < chunk_count; ++chunk )
+        writeBytes( _buffers[chunk].data(), _buffers[chunk].size() );
+    }
+
+    flush();
+  }
+
+  /// Appends `value` in decimal
+  static void appendNumber( std::string& buffer, std::uint64_t const value )
+  {
+    char digits[20];
+    char* const end = std::to_chars( digits, digits + sizeof(digits), value ).ptr;
+    buffer.append( digits, end - digits );
+  }
+
+  /// Appends `value` right-aligned in a field of `width` characters
+  static void appendPadded( std::string& buffer, std::uint64_t const value, size_t const width )
+  {
+    char digits[20];
+    char* const end = std::to_chars( digits, digits + sizeof(digits), value ).ptr;
+    size_t const length = end - digits;
+    if ( length < width )
+      buffer.append( width - length, ' ' );
+    buffer.append( digits, end - digits );
+  }
+
+  void writeBytes( char const* data, size_t size );
+
+  void flush();
+
+  int _fd;                           ///< destination when `_out` is null
+  std::ostream* _out;
+  ThreadPool _pool;
+  std::vector<std::string> _buffers; ///< one per worker, reused across rounds
+};
@@ -0,0 +1,140 @@
+/** \file IncrementalConnectivity.hpp
+  * Online connectivity for graphs that only gain edges.
+  *
+  * \author Brian Heim
+  * \date   2026-10-17
+  */
+
+#pragma once
+
+#include "AbstractUGraph.hpp"
+
+#include <cstddef> // size_t
+#include <limits> // numeric_limits
+#include <utility> // swap
+#include <vector>
+
+/// Union-find over the vertices of a growing graph.
+///
+/// Feed it every edge added to the graph and it answers `connected()`,
+/// `count()` and `componentSize()` in near-constant amortized time, where
+/// `ConnectedComponents` would have to be rebuilt. Trees are joined by
+/// size and paths are halved on every lookup. Edges can't be removed.
+class IncrementalConnectivity
+{
+public:
+  typedef AbstractUGraph::VertexID VertexID;
+  typedef AbstractUGraph::size_type size_type;
+  typedef AbstractUGraph::Edge Edge;
+  typedef AbstractUGraph::EdgeList EdgeList;
+
+  /// `vertex_count` vertices and no edges
+  explicit IncrementalConnectivity( size_type const vertex_count = 0 ) :
+    _parents(vertex_count),
+    _sizes(vertex_count, 1),
+    _count(vertex_count)
+  {
+    for ( size_type v = 0; v < vertex_count; ++v )
+      _parents[v] = v;
+  }
+
+  /// Starts from the result of a components search over `vertex_count`
+  /// vertices, such as `ConnectedComponents` or `ParallelConnectedComponents`
+  template<class CC>
+  IncrementalConnectivity( size_type const vertex_count, CC const& components ) :
+    _parents(vertex_count),
+    _sizes(vertex_count, 1),
+    _count(components.count())
+  {
+    // the first vertex of each component becomes its root
+    std::vector<VertexID> roots( components.count(), NO_ROOT );
+    for ( size_type v = 0; v < vertex_count; ++v ) {
+      VertexID& root = roots[components.id(v)];
+      if ( root == NO_ROOT ) {
+        root = v;
+      } else {
+        ++_sizes[root];
+      }
+      _parents[v] = root;
+    }
+  }
+
+  //--------- Accessors ---------//
+
+  /// Number of vertices
+  size_type v() const { return _parents.size(); }
+
+  /// Returns the number of separate components in the graph
+  size_type count() const { return _count; }
+
+  /// Returns whether `source` is connected to `target`
+  bool connected( VertexID const source, VertexID const target ) const
+  {
+    return find( source ) == find( target );
+  }
+
+  /// Number of vertices in the component of `v`
+  size_type componentSize( VertexID const v ) const { return _sizes[find( v )]; }
+
+  /// A vertex standing for the component of `v`. It stays the same until
+  /// an edge joins that component to another.
+  VertexID find( VertexID v ) const
+  {
+    // path halving: point every other vertex on the way at its grandparent
+    while ( _parents[v] != v ) {
+      _parents[v] = _parents[_parents[v]];
+      v = _parents[v];
+    }
+    return v;
+  }
+
+  //--------- Mutators ---------//
+
+  /// Records an edge between `v` and `w`; returns whether it joined two
+  /// components
+  bool addEdge( VertexID const v, VertexID const w )
+  {
+    VertexID root_v = find( v );
+    VertexID root_w = find( w );
+    if ( root_v == root_w )
+      return false;
+
+    // hang the smaller tree under the larger to keep paths short
+    if ( _sizes[root_v] < _sizes[root_w] )
+      std::swap( root_v, root_w );
+    _parents[root_w] = root_v;
+    _sizes[root_v] += _sizes[root_w];
+    --_count;
+    return true;
+  }
+
+  /// Records every edge of `edges`; returns how many joined two components
+  size_type addEdges( EdgeList const& edges )
+  {
+    size_type joins = 0;
+    for ( auto const& edge : edges )
+      joins += addEdge( edge.first, edge.second );
+    return joins;
+  }
+
+  /// Records every edge of `graph`, which may be any graph with `neighbors()`
+  template<class G>
+  size_type addEdgesOf( G const& graph )
+  {
+    size_type joins = 0;
+    for ( VertexID v = 0; v < graph.v(); ++v )
+      for ( auto const w : graph.neighbors(v) )
+        if ( v < w )
+          joins += addEdge( v, w );
+    return joins;
+  }
+
+private:
+
+  static constexpr VertexID NO_ROOT = std::numeric_limits<VertexID>::max();
+
+  /// Lookups only shorten paths, which doesn't change any answer
+  mutable std::vector<VertexID> _parents;
+  std::vector<size_type> _sizes; ///< vertex count of each tree, valid at roots
+  size_type _count;
+};
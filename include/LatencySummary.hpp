@@ -0,0 +1,78 @@
+/** \file LatencySummary.hpp
+  * Throughput and latency percentiles of a batch of timed operations.
+  *
+  * \author Brian Heim
+  * \date   2026-10-17
+  */
+
+#pragma once
+
+#include <algorithm> // sort
+#include <cmath> // ceil
+#include <cstddef> // size_t
+#include <iomanip> // setprecision
+#include <ostream>
+#include <vector>
+
+/// Summary of per-operation latencies, in seconds, and the wall time they
+/// took together.
+///
+/// Percentiles are nearest-rank: `p50` is the smallest latency at least
+/// half of the operations took no longer than.
+struct LatencySummary
+{
+  size_t count;
+  double wall_seconds;
+  double mean;
+  double p50;
+  double p90;
+  double p99;
+  double max;
+
+  /// Summarizes `latencies`, which took `wall_seconds` in all
+  static LatencySummary of( std::vector<double> latencies, double const wall_seconds )
+  {
+    LatencySummary summary = { latencies.size(), wall_seconds, 0, 0, 0, 0, 0 };
+    if ( latencies.empty() )
+      return summary;
+
+    std::sort( latencies.begin(), latencies.end() );
+    double total = 0;
+    for ( auto const latency : latencies )
+      total += latency;
+    summary.mean = total / latencies.size();
+    summary.p50 = percentile( latencies, 0.50 );
+    summary.p90 = percentile( latencies, 0.90 );
+    summary.p99 = percentile( latencies, 0.99 );
+    summary.max = latencies.back();
+    return summary;
+  }
+
+  /// Operations per second of wall time
+  double throughput() const { return wall_seconds > 0 ? count / wall_seconds : 0; }
+
+private:
+
+  /// Nearest-rank percentile `p` of `sorted`, which is not empty
+  static double percentile( std::vector<double> const& sorted, double const p )
+  {
+    size_t const rank = size_t( std::ceil( p * sorted.size() ) );
+    return sorted[rank > 0 ? rank - 1 : 0];
+  }
+};
+
+/// Prints `summary` on two lines, latencies in microseconds
+inline std::ostream& operator<<( std::ostream& os, LatencySummary const& summary )
+{
+  auto const flags = os.flags();
+  auto const precision = os.precision();
+  os << std::fixed << std::setprecision(1)
+     << summary.count << " queries in " << summary.wall_seconds * 1e3 << " ms, "
+     << summary.throughput() << " queries/s\n"
+     << "latency us: mean " << summary.mean * 1e6 << ", p50 " << summary.p50 * 1e6
+     << ", p90 " << summary.p90 * 1e6 << ", p99 " << summary.p99 * 1e6
+     << ", max " << summary.max * 1e6 << "\n";
+  os.flags( flags );
+  os.precision( precision );
+  return os;
+}
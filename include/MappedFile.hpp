@@ -0,0 +1,41 @@
+/** \file MappedFile.hpp
+ * Read-only memory mapping of a whole file.
+ *
+ * \author Brian Heim
+ * \date   2026-10-17
+ */
+
+#pragma once
+
+#include <cstddef> // size_t
+#include <string> // string
+
+/// Maps a file read-only into memory for the lifetime of the object.
+/// Throws `std::system_error` if the file can't be opened or mapped.
+class MappedFile
+{
+public:
+  /// Expected access pattern, passed on to the kernel as a paging hint
+  enum class Access { Sequential, Random };
+
+  explicit MappedFile( std::string const& filename, Access const access = Access::Sequential );
+
+  MappedFile( MappedFile const& ) = delete;
+  MappedFile& operator=( MappedFile const& ) = delete;
+
+  ~MappedFile();
+
+  /// Start of the mapped bytes; null for an empty file
+  char const* data() const { return _data; }
+
+  /// Number of mapped bytes
+  size_t size() const { return _size; }
+
+  /// Name the file was opened with
+  std::string const& filename() const { return _filename; }
+
+private:
+  std::string _filename;
+  char const* _data;
+  size_t _size;
+};
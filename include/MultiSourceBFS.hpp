@@ -0,0 +1,130 @@
+/** \file MultiSourceBFS.hpp
+  * Bit-parallel breadth-first search from many sources at once.
+  *
+  * \author Brian Heim
+  * \date   2026-10-17
+  */
+
+#pragma once
+
+#include "BitKernels.hpp"
+
+#include <algorithm> // fill, min
+#include <cstddef> // size_t
+#include <limits> // numeric_limits
+#include <stdexcept> // logic_error
+#include <vector>
+
+/// Breadth-first searches from many sources sharing one pass over the
+/// graph, in the style of MS-BFS (Then et al.).
+///
+/// Sources are taken `BATCH_SIZE` at a time, one bit each. Every vertex
+/// holds a word of the searches that have seen it and a word of those
+/// whose frontier it is in, so expanding a vertex reads its adjacency list
+/// once for all the searches of the batch.
+///
+/// For each source, `count()` matches `BreadthFirstSearch::count()`.
+/// Distances cost one `V_ID` per source and vertex, so they are only kept
+/// on request.
+template<class G> class MultiSourceBFS
+{
+public:
+  typedef typename G::VertexID V_ID;
+  typedef typename G::size_type size_type;
+  typedef BitKernels::Word Word;
+
+  /// Sources searched together, one per bit of a word
+  static constexpr size_t BATCH_SIZE = BitKernels::WORD_BITS;
+
+  /// Distance of unreached vertices
+  static constexpr V_ID UNREACHED = std::numeric_limits<V_ID>::max();
+
+  /// Search from every vertex in `sources`; with `record_distances`, keep
+  /// the distance of every vertex from every source
+  MultiSourceBFS( G const& g, std::vector<V_ID> const& sources, bool const record_distances = false ) :
+    _vertex_count(g.v()),
+    _counts(sources.size(), 0),
+    _eccentricities(sources.size(), 0),
+    _distances(record_distances ? sources.size() * g.v() : 0, UNREACHED)
+  {
+    std::vector<Word> seen( _vertex_count );
+    std::vector<Word> visit( _vertex_count );
+    std::vector<Word> visit_next( _vertex_count );
+
+    for ( size_t first = 0; first < sources.size(); first += BATCH_SIZE ) {
+      size_t const lanes = std::min( BATCH_SIZE, sources.size() - first );
+
+      std::fill( seen.begin(), seen.end(), 0 );
+      std::fill( visit.begin(), visit.end(), 0 );
+      for ( size_t lane = 0; lane < lanes; ++lane ) {
+        Word const bit = Word(1) << lane;
+        seen[sources[first + lane]] |= bit;
+        visit[sources[first + lane]] |= bit;
+        recordDistance( first + lane, sources[first + lane], 0 );
+      }
+
+      for ( V_ID depth = 1; ; ++depth ) {
+        // every search that reaches a new vertex at this depth
+        Word active = 0;
+        std::fill( visit_next.begin(), visit_next.end(), 0 );
+        for ( V_ID v = 0; v < _vertex_count; ++v ) {
+          Word const searches = visit[v];
+          if ( searches == 0 )
+            continue;
+          for ( auto const w : g.neighbors(v) ) {
+            Word const fresh = searches & ~seen[w];
+            if ( fresh == 0 )
+              continue;
+            seen[w] |= fresh;
+            visit_next[w] |= fresh;
+            active |= fresh;
+            if ( !_distances.empty() )
+              for ( Word bits = fresh; bits != 0; bits &= bits - 1 )
+                recordDistance( first + BitKernels::countTrailingZeros(bits), w, depth );
+          }
+        }
+        if ( active == 0 )
+          break;
+
+        for ( Word bits = active; bits != 0; bits &= bits - 1 )
+          _eccentricities[first + BitKernels::countTrailingZeros(bits)] = depth;
+        visit.swap( visit_next );
+      }
+
+      for ( V_ID v = 0; v < _vertex_count; ++v )
+        for ( Word bits = seen[v]; bits != 0; bits &= bits - 1 )
+          ++_counts[first + BitKernels::countTrailingZeros(bits)];
+    }
+  }
+
+  /// Number of sources searched
+  size_t sourceCount() const { return _counts.size(); }
+
+  /// How many vertices are connected to the `i`th source?
+  size_t count( size_t const i ) const { return _counts[i]; }
+
+  /// Greatest distance from the `i`th source to a vertex it reaches
+  V_ID eccentricity( size_t const i ) const { return _eccentricities[i]; }
+
+  /// Distance from the `i`th source to `v`, or `UNREACHED`. Throws
+  /// `std::logic_error` unless distances were recorded.
+  V_ID distance( size_t const i, V_ID const v ) const
+  {
+    if ( _distances.empty() )
+      throw std::logic_error( "MultiSourceBFS: distances were not recorded" );
+    return _distances[i * _vertex_count + v];
+  }
+
+private:
+
+  void recordDistance( size_t const i, V_ID const v, V_ID const depth )
+  {
+    if ( !_distances.empty() )
+      _distances[i * _vertex_count + v] = depth;
+  }
+
+  size_type _vertex_count;
+  std::vector<size_t> _counts;
+  std::vector<V_ID> _eccentricities;
+  std::vector<V_ID> _distances; ///< source-major, when recorded
+};
@@ -0,0 +1,127 @@
+/** \file ParallelBFS.hpp
+  * Level-synchronous breadth-first search on a thread pool.
+  *
+  * \author Brian Heim
+  * \date   2026-10-17
+  */
+
+#pragma once
+
+#include "ThreadPool.hpp"
+
+#include <algorithm> // min
+#include <atomic>
+#include <cstddef> // size_t
+#include <limits> // numeric_limits
+#include <vector>
+
+/// Breadth-first search from one source that expands each level in
+/// parallel.
+///
+/// The frontier is cut into tasks handed out by a `ThreadPool`. A worker
+/// claims an unvisited neighbor by compare-and-swapping its parent from
+/// `NO_PARENT`, so every vertex is claimed exactly once, and appends it to
+/// its own next-frontier buffer. The buffers are joined between levels.
+///
+/// Reachability and `count()` match `BreadthFirstSearch` from the same
+/// source. Distances are exact; which of several equally near parents a
+/// vertex gets depends on scheduling.
+template<class G> class ParallelBFS
+{
+public:
+  typedef typename G::VertexID V_ID;
+  typedef typename G::size_type size_type;
+
+  /// Parent of unreached vertices
+  static constexpr V_ID NO_PARENT = std::numeric_limits<V_ID>::max();
+
+  /// Distance of unreached vertices
+  static constexpr V_ID UNREACHED = std::numeric_limits<V_ID>::max();
+
+  /// Frontier vertices per task
+  static constexpr size_t GRAIN = 256;
+
+  /// Find vertices connected to source vertex `s`, using the workers of `pool`
+  ParallelBFS( G const& g, V_ID s, ThreadPool& pool ) :
+    _parents(g.v()),
+    _distances(g.v(), UNREACHED),
+    _count(0)
+  {
+    size_type const vertex_count = g.v();
+    pool.parallelFor( taskCount( vertex_count, pool ), [&]( size_t const task, size_t ) {
+      size_t const end = std::min<size_t>( vertex_count, (task + 1) * chunkSize( vertex_count, pool ) );
+      for ( size_t v = task * chunkSize( vertex_count, pool ); v < end; ++v )
+        _parents[v].store( NO_PARENT, std::memory_order_relaxed );
+    } );
+
+    _parents[s].store( s, std::memory_order_relaxed );
+    _distances[s] = 0;
+
+    std::vector<V_ID> frontier( 1, s );
+    std::vector<std::vector<V_ID>> next( pool.size() );
+    std::vector<size_t> starts( pool.size() + 1 );
+
+    for ( V_ID depth = 1; !frontier.empty(); ++depth ) {
+      _count += frontier.size();
+
+      size_t const frontier_size = frontier.size();
+      size_t const chunk = chunkSize( frontier_size, pool );
+      pool.parallelFor( taskCount( frontier_size, pool ), [&]( size_t const task, size_t const worker ) {
+        std::vector<V_ID>& found = next[worker];
+        size_t const end = std::min( frontier_size, (task + 1) * chunk );
+        for ( size_t i = task * chunk; i < end; ++i ) {
+          V_ID const v = frontier[i];
+          for ( auto const w : g.neighbors(v) ) {
+            // a plain load first skips the expensive CAS for visited vertices
+            V_ID expected = NO_PARENT;
+            if ( _parents[w].load( std::memory_order_relaxed ) == NO_PARENT &&
+                 _parents[w].compare_exchange_strong( expected, v, std::memory_order_relaxed ) ) {
+              _distances[w] = depth;
+              found.push_back( w );
+            }
+          }
+        }
+      } );
+
+      // join the per-worker buffers into the next frontier
+      starts[0] = 0;
+      for ( size_t worker = 0; worker < pool.size(); ++worker )
+        starts[worker+1] = starts[worker] + next[worker].size();
+      frontier.resize( starts[pool.size()] );
+      pool.parallelFor( pool.size(), [&]( size_t const worker, size_t ) {
+        std::copy( next[worker].begin(), next[worker].end(), frontier.begin() + starts[worker] );
+        next[worker].clear();
+      } );
+    }
+  }
+
+  /// Is `v` connected to the source vertex?
+  bool marked( V_ID v ) const { return parent( v ) != NO_PARENT; }
+
+  /// How many vertices are connected to the source?
+  size_t count() const { return _count; }
+
+  /// Vertex `v` was reached from; the source is its own parent
+  V_ID parent( V_ID v ) const { return _parents[v].load( std::memory_order_relaxed ); }
+
+  /// Number of edges on a shortest path from the source, or `UNREACHED`
+  V_ID distance( V_ID v ) const { return _distances[v]; }
+
+private:
+
+  /// Items per task when splitting `items` over the pool
+  static size_t chunkSize( size_t const items, ThreadPool const& pool )
+  {
+    return std::max( GRAIN, (items + pool.size() * 8 - 1) / (pool.size() * 8) );
+  }
+
+  static size_t taskCount( size_t const items, ThreadPool const& pool )
+  {
+    size_t const chunk = chunkSize( items, pool );
+    return (items + chunk - 1) / chunk;
+  }
+
+  std::vector<std::atomic<V_ID>> _parents;
+  std::vector<V_ID> _distances;
+  size_t _count;
+};
@@ -0,0 +1,201 @@
+/** \file ParallelConnectedComponents.hpp
+  * Connected components by concurrent union-find with neighbor sampling.
+  *
+  * \author Brian Heim
+  * \date   2026-10-17
+  */
+
+#pragma once
+
+#include "ThreadPool.hpp"
+
+#include <algorithm> // max, min
+#include <atomic>
+#include <cstddef> // size_t
+#include <random> // mt19937_64
+#include <unordered_map>
+#include <vector>
+
+/// Connected components in the style of Afforest (Sutton et al.).
+///
+/// Every vertex points at a parent in a union-find forest, and `link` hooks
+/// the root of the larger ID under the smaller by compare-and-swap, so
+/// workers can join trees without locks and each root is the smallest
+/// vertex of its tree. The search first links every vertex to just its
+/// first `NEIGHBOR_ROUNDS` neighbors and compresses the trees, which
+/// usually gathers most of the graph into one tree. A random sample then
+/// names that largest tree, and only vertices outside it have their
+/// remaining edges linked; in an undirected graph each such edge is seen
+/// from its other end anyway.
+///
+/// `count()`, `id()` and `connected()` match `ConnectedComponents`: ids are
+/// dense and numbered in order of each component's smallest vertex.
+template<class G> class ParallelConnectedComponents
+{
+public:
+  typedef typename G::VertexID V_ID;
+  typedef typename G::size_type size_type;
+
+  /// Neighbors of each vertex linked before sampling
+  static constexpr size_t NEIGHBOR_ROUNDS = 2;
+
+  /// Vertices sampled to find the largest tree
+  static constexpr size_t SAMPLE_SIZE = 1024;
+
+  /// Vertices per task
+  static constexpr size_t GRAIN = 4096;
+
+  /// Find the connected components of `g`, using the workers of `pool`
+  ParallelConnectedComponents( G const& g, ThreadPool& pool ) :
+    _ids(g.v()),
+    _count(0)
+  {
+    size_type const vertex_count = g.v();
+    std::vector<std::atomic<V_ID>> parents( vertex_count );
+    forEachVertex( vertex_count, pool, [&]( V_ID const v ) {
+      parents[v].store( v, std::memory_order_relaxed );
+    } );
+
+    // link each vertex to its first few neighbors, one at a time so that
+    // the trees stay shallow
+    for ( size_t round = 0; round < NEIGHBOR_ROUNDS; ++round ) {
+      forEachVertex( vertex_count, pool, [&]( V_ID const v ) {
+        size_t i = 0;
+        for ( auto const w : g.neighbors(v) ) {
+          if ( i++ == round ) {
+            link( parents, v, w );
+            break;
+          }
+        }
+      } );
+      compress( parents, pool );
+    }
+
+    // link the rest of the edges, except from vertices already in the
+    // largest tree
+    V_ID const largest = sampleLargestTree( parents );
+    forEachVertex( vertex_count, pool, [&]( V_ID const v ) {
+      if ( parents[v].load( std::memory_order_relaxed ) == largest )
+        return;
+      size_t i = 0;
+      for ( auto const w : g.neighbors(v) )
+        if ( i++ >= NEIGHBOR_ROUNDS )
+          link( parents, v, w );
+    } );
+    compress( parents, pool );
+
+    // number the roots in vertex order, then give each vertex its root's id
+    size_t const tasks = taskCount( vertex_count );
+    std::vector<size_type> firsts( tasks + 1, 0 );
+    pool.parallelFor( tasks, [&]( size_t const task, size_t ) {
+      size_type roots = 0;
+      for ( size_t v = task * GRAIN, end = taskEnd( task, vertex_count ); v < end; ++v )
+        roots += parents[v].load( std::memory_order_relaxed ) == v;
+      firsts[task + 1] = roots;
+    } );
+    for ( size_t task = 0; task < tasks; ++task )
+      firsts[task + 1] += firsts[task];
+    _count = firsts[tasks];
+
+    pool.parallelFor( tasks, [&]( size_t const task, size_t ) {
+      size_type id = firsts[task];
+      for ( size_t v = task * GRAIN, end = taskEnd( task, vertex_count ); v < end; ++v )
+        if ( parents[v].load( std::memory_order_relaxed ) == v )
+          _ids[v] = id++;
+    } );
+    forEachVertex( vertex_count, pool, [&]( V_ID const v ) {
+      V_ID const root = parents[v].load( std::memory_order_relaxed );
+      if ( root != v )
+        _ids[v] = _ids[root];
+    } );
+  }
+
+  /// Returns whether the `source` connected to `target`
+  bool connected( V_ID source, V_ID target ) const { return _ids[source] == _ids[target]; }
+
+  /// Returns the number of separate components in the graph
+  size_type count() const { return _count; }
+
+  /// Returns the ID of the given vertex
+  size_type id( V_ID vertex ) const { return _ids[vertex]; }
+
+private:
+
+  typedef std::vector<std::atomic<V_ID>> ParentArray;
+
+  /// Joins the trees of `u` and `v`, hooking the larger root under the smaller
+  static void link( ParentArray& parents, V_ID const u, V_ID const v )
+  {
+    V_ID p1 = parents[u].load( std::memory_order_relaxed );
+    V_ID p2 = parents[v].load( std::memory_order_relaxed );
+    while ( p1 != p2 ) {
+      V_ID const high = std::max( p1, p2 );
+      V_ID const low = std::min( p1, p2 );
+      V_ID high_parent = parents[high].load( std::memory_order_relaxed );
+      // done if another worker already hooked them; hook if `high` is a root
+      if ( high_parent == low )
+        break;
+      if ( high_parent == high &&
+           parents[high].compare_exchange_strong( high_parent, low, std::memory_order_relaxed ) )
+        break;
+      p1 = parents[parents[high].load( std::memory_order_relaxed )].load( std::memory_order_relaxed );
+      p2 = parents[low].load( std::memory_order_relaxed );
+    }
+  }
+
+  /// Points every vertex straight at its root
+  static void compress( ParentArray& parents, ThreadPool& pool )
+  {
+    forEachVertex( parents.size(), pool, [&]( V_ID const v ) {
+      V_ID parent = parents[v].load( std::memory_order_relaxed );
+      V_ID grandparent = parents[parent].load( std::memory_order_relaxed );
+      while ( parent != grandparent ) {
+        parents[v].store( grandparent, std::memory_order_relaxed );
+        parent = grandparent;
+        grandparent = parents[parent].load( std::memory_order_relaxed );
+      }
+    } );
+  }
+
+  /// Root of the tree holding the most of a random sample of vertices
+  static V_ID sampleLargestTree( ParentArray const& parents )
+  {
+    if ( parents.empty() )
+      return 0;
+
+    std::mt19937_64 engine( 0x5eed );
+    std::uniform_int_distribution<size_t> pick( 0, parents.size() - 1 );
+    std::unordered_map<V_ID, size_t> counts;
+    V_ID largest = 0;
+    size_t largest_count = 0;
+    for ( size_t i = 0; i < SAMPLE_SIZE; ++i ) {
+      V_ID const root = parents[pick(engine)].load( std::memory_order_relaxed );
+      size_t const count = ++counts[root];
+      if ( count > largest_count ) {
+        largest = root;
+        largest_count = count;
+      }
+    }
+    return largest;
+  }
+
+  /// Calls `fn(v)` for every vertex, split into tasks over the pool
+  template<class F>
+  static void forEachVertex( size_type const vertex_count, ThreadPool& pool, F&& fn )
+  {
+    pool.parallelFor( taskCount( vertex_count ), [&]( size_t const task, size_t ) {
+      for ( size_t v = task * GRAIN, end = taskEnd( task, vertex_count ); v < end; ++v )
+        fn( V_ID(v) );
+    } );
+  }
+
+  static size_t taskCount( size_type const vertex_count ) { return (vertex_count + GRAIN - 1) / GRAIN; }
+
+  static size_t taskEnd( size_t const task, size_type const vertex_count )
+  {
+    return std::min<size_t>( vertex_count, (task + 1) * GRAIN );
+  }
+
+  std::vector<V_ID> _ids;
+  size_type _count;
+};
@@ -0,0 +1,168 @@
+/** \file ParallelCoreDecomposition.hpp
+  * k-core decomposition by level-synchronous parallel peeling.
+  *
+  * \author Brian Heim
+  * \date   2026-10-17
+  */
+
+#pragma once
+
+#include "ThreadPool.hpp"
+
+#include <algorithm> // min, sort
+#include <atomic>
+#include <cstddef> // size_t
+#include <limits> // numeric_limits
+#include <vector>
+
+/// Core number of every vertex by peeling whole frontiers at once, in the
+/// style of ParK (Dasari et al.).
+///
+/// For each level k, a scan of the vertices still in the graph finds those
+/// with at most k neighbors left. They are peeled together with core
+/// number k, and every neighbor whose remaining degree drops to k by an
+/// atomic decrement joins the next frontier of the same level. A level
+/// ends when its frontier empties. Each scan also drops the vertices
+/// peeled since the last, so later levels only scan what is left, and an
+/// empty scan skips straight to the smallest degree left.
+///
+/// `core()` and `degeneracy()` match `CoreDecomposition`. `order()` is also
+/// a degeneracy ordering, frontier by frontier, each frontier sorted by ID
+/// so that it doesn't depend on scheduling; it may differ from the
+/// sequential one.
+template<class G> class ParallelCoreDecomposition
+{
+public:
+  typedef typename G::VertexID V_ID;
+  typedef typename G::size_type size_type;
+
+  /// Vertices per task when scanning
+  static constexpr size_t GRAIN = 4096;
+
+  /// Frontier vertices per task when peeling; hubs make these uneven
+  static constexpr size_t PEEL_GRAIN = 64;
+
+  /// Peel every vertex of `g`, using the workers of `pool`
+  ParallelCoreDecomposition( G const& g, ThreadPool& pool ) :
+    _cores(g.v(), NO_CORE),
+    _order(),
+    _positions(g.v()),
+    _degeneracy(0)
+  {
+    size_type const vertex_count = g.v();
+    _order.reserve( vertex_count );
+    std::vector<std::atomic<V_ID>> degrees( vertex_count );
+    std::vector<V_ID> remaining( vertex_count );
+    forEach( vertex_count, GRAIN, pool, [&]( size_t const v, size_t ) {
+      V_ID degree = 0;
+      for ( auto const w : g.neighbors(v) )
+        degree += w != v;
+      degrees[v].store( degree, std::memory_order_relaxed );
+      remaining[v] = v;
+    } );
+
+    std::vector<std::vector<V_ID>> found( pool.size() );
+    std::vector<V_ID> frontier;
+    V_ID level = 0;
+    while ( !remaining.empty() ) {
+      // scan for this level's frontier, dropping vertices already peeled,
+      // and note the smallest degree left in case the frontier is empty
+      size_t const tasks = (remaining.size() + GRAIN - 1) / GRAIN;
+      std::vector<std::vector<V_ID>> task_frontiers( tasks ), task_kept( tasks );
+      std::vector<V_ID> task_min( tasks, NO_CORE );
+      pool.parallelFor( tasks, [&]( size_t const task, size_t ) {
+        size_t const end = std::min( remaining.size(), (task + 1) * GRAIN );
+        for ( size_t i = task * GRAIN; i < end; ++i ) {
+          V_ID const v = remaining[i];
+          if ( _cores[v] != NO_CORE )
+            continue;
+          V_ID const degree = degrees[v].load( std::memory_order_relaxed );
+          if ( degree <= level ) {
+            task_frontiers[task].push_back( v );
+          } else {
+            task_kept[task].push_back( v );
+            task_min[task] = std::min( task_min[task], degree );
+          }
+        }
+      } );
+      frontier.clear();
+      remaining.clear();
+      V_ID smallest = NO_CORE;
+      for ( size_t task = 0; task < tasks; ++task ) {
+        frontier.insert( frontier.end(), task_frontiers[task].begin(), task_frontiers[task].end() );
+        remaining.insert( remaining.end(), task_kept[task].begin(), task_kept[task].end() );
+        smallest = std::min( smallest, task_min[task] );
+      }
+      if ( frontier.empty() ) {
+        // nothing changed since the scan, so skip straight to the next
+        // level with any vertices
+        level = smallest;
+        continue;
+      }
+
+      while ( !frontier.empty() ) {
+        _degeneracy = level;
+        for ( auto const v : frontier ) {
+          _cores[v] = level;
+          _positions[v] = _order.size();
+          _order.push_back( v );
+        }
+
+        // a neighbor joins the next frontier as its degree drops to level
+        pool.parallelFor( (frontier.size() + PEEL_GRAIN - 1) / PEEL_GRAIN, [&]( size_t const task, size_t const worker ) {
+          size_t const end = std::min( frontier.size(), (task + 1) * PEEL_GRAIN );
+          for ( size_t i = task * PEEL_GRAIN; i < end; ++i ) {
+            for ( auto const u : g.neighbors( frontier[i] ) ) {
+              if ( _cores[u] != NO_CORE )
+                continue;
+              if ( degrees[u].fetch_sub( 1, std::memory_order_relaxed ) == level + 1 )
+                found[worker].push_back( u );
+            }
+          }
+        } );
+        frontier.clear();
+        for ( auto& vertices : found ) {
+          frontier.insert( frontier.end(), vertices.begin(), vertices.end() );
+          vertices.clear();
+        }
+        std::sort( frontier.begin(), frontier.end() );
+      }
+
+      // every vertex left now has more than `level` neighbors left
+      ++level;
+    }
+  }
+
+  /// Core number of `v`
+  V_ID core( V_ID v ) const { return _cores[v]; }
+
+  /// Largest core number
+  V_ID degeneracy() const { return _degeneracy; }
+
+  /// Vertices in the order they were peeled, by nondecreasing core number
+  std::vector<V_ID> const& order() const { return _order; }
+
+  /// Position of `v` in `order()`
+  size_type position( V_ID v ) const { return _positions[v]; }
+
+private:
+
+  /// Core number of a vertex not yet peeled
+  static constexpr V_ID NO_CORE = std::numeric_limits<V_ID>::max();
+
+  /// Calls `fn(i, worker)` for every `i` in [0, count), in tasks of `grain`
+  template<class F>
+  static void forEach( size_t const count, size_t const grain, ThreadPool& pool, F&& fn )
+  {
+    pool.parallelFor( (count + grain - 1) / grain, [&]( size_t const task, size_t const worker ) {
+      size_t const end = std::min( count, (task + 1) * grain );
+      for ( size_t i = task * grain; i < end; ++i )
+        fn( i, worker );
+    } );
+  }
+
+  std::vector<V_ID> _cores;
+  std::vector<V_ID> _order;
+  std::vector<size_type> _positions;
+  V_ID _degeneracy;
+};
@@ -0,0 +1,96 @@
+/** \file Permutation.hpp
+ * Bijection between original and relabeled vertex IDs.
+ *
+ * \author Brian Heim
+ * \date   2026-10-17
+ */
+
+#pragma once
+
+#include "AbstractUGraph.hpp"
+
+#include <cstddef> // size_t
+#include <stdexcept> // invalid_argument
+#include <string> // to_string
+#include <utility> // move
+#include <vector> // vector
+
+/// A relabeling of the vertices of a graph.
+///
+/// `toNew(v)` is the ID vertex `v` gets in the relabeled graph and
+/// `toOld(u)` takes it back. Results computed on a relabeled graph are
+/// translated back with `toOld` for vertex IDs (paths, cycles) and
+/// `toOriginalOrder` for per-vertex arrays (marks, component ids).
+class Permutation
+{
+public:
+  typedef AbstractUGraph::VertexID VertexID;
+  typedef AbstractUGraph::size_type size_type;
+
+  /// identity on zero vertices
+  Permutation() : _new_ids(), _old_ids() { }
+
+  /// Permutation placing vertex `order[u]` at new ID `u`. Throws
+  /// `std::invalid_argument` if `order` is not a permutation of [0, size).
+  explicit Permutation( std::vector<VertexID> order ) :
+    _new_ids(order.size(), 0),
+    _old_ids(std::move(order))
+  {
+    std::vector<bool> seen( _old_ids.size(), false );
+    for ( size_type u = 0; u < _old_ids.size(); ++u ) {
+      VertexID const v = _old_ids[u];
+      if ( v >= _old_ids.size() || seen[v] )
+        throw std::invalid_argument( "Not a permutation: vertex " + std::to_string(v) + " at position " + std::to_string(u) );
+      seen[v] = true;
+      _new_ids[v] = u;
+    }
+  }
+
+  /// The identity on `size` vertices
+  static Permutation identity( size_type const size )
+  {
+    std::vector<VertexID> order( size );
+    for ( size_type u = 0; u < size; ++u )
+      order[u] = u;
+    return Permutation( std::move(order) );
+  }
+
+  /// Number of vertices
+  size_type size() const { return _old_ids.size(); }
+
+  /// New ID of original vertex `v`
+  VertexID toNew( VertexID const v ) const { return _new_ids[v]; }
+
+  /// Original ID of new vertex `u`
+  VertexID toOld( VertexID const u ) const { return _old_ids[u]; }
+
+  /// Forward array: `forward()[v] == toNew(v)`
+  std::vector<VertexID> const& forward() const { return _new_ids; }
+
+  /// Inverse array: `inverse()[u] == toOld(u)`
+  std::vector<VertexID> const& inverse() const { return _old_ids; }
+
+  /// Original IDs of the relabeled vertices in `vertices`, such as a path
+  template<class Range>
+  std::vector<VertexID> toOldIds( Range const& vertices ) const
+  {
+    std::vector<VertexID> old_ids;
+    for ( auto const u : vertices )
+      old_ids.push_back( toOld(u) );
+    return old_ids;
+  }
+
+  /// Per-vertex values indexed by original ID, from values indexed by new ID
+  template<class T>
+  std::vector<T> toOriginalOrder( std::vector<T> const& by_new_id ) const
+  {
+    std::vector<T> by_old_id( by_new_id.size() );
+    for ( size_type v = 0; v < by_new_id.size(); ++v )
+      by_old_id[v] = by_new_id[toNew(v)];
+    return by_old_id;
+  }
+
+private:
+  std::vector<VertexID> _new_ids; ///< indexed by original ID
+  std::vector<VertexID> _old_ids; ///< indexed by new ID
+};
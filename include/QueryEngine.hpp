@@ -0,0 +1,253 @@
+/** \file QueryEngine.hpp
+  * Reachability, connectivity, path and cycle queries answered on many
+  * threads at once.
+  *
+  * \author Brian Heim
+  * \date   2026-10-17
+  */
+
+#pragma once
+
+#include "BreadthFirstSearch.hpp"
+#include "ConnectedComponents.hpp"
+#include "GraphInfo.hpp"
+#include "GraphQuery.hpp"
+#include "LatencySummary.hpp"
+#include "ThreadPool.hpp"
+
+#include <algorithm> // reverse
+#include <atomic>
+#include <chrono>
+#include <cstddef> // size_t
+#include <fstream> // ifstream, ofstream
+#include <istream>
+#include <iostream> // cin, cout, cerr, clog
+#include <memory> // unique_ptr
+#include <mutex> // once_flag, call_once
+#include <ostream>
+#include <stdexcept> // invalid_argument, runtime_error
+#include <string> // string, getline, to_string
+#include <utility> // move
+#include <vector>
+
+/// Answers queries about a graph loaded once, for scripted workloads and
+/// for the graph server.
+///
+/// Queries and answers are those of GraphQuery.hpp. `run` reads them as
+/// text lines, skipping blank lines and lines starting with `#`.
+///
+/// Every reach, connected and path query searches from U in a workspace
+/// of type `Search` (see BreadthFirstSearch.hpp), one per worker, so paths
+/// are shortest with the default `BreadthFirstSearch` and tree paths with
+/// a depth-first one. The first connected query labels every component
+/// instead; from then on connected and reach queries are lookups. The
+/// first cycle query finds the cycle every later one answers with.
+template<class G, class Search = BreadthFirstSearch<G>> class QueryEngine
+{
+public:
+  typedef typename G::VertexID V_ID;
+  typedef typename G::size_type size_type;
+  typedef GraphQuery::Query Query;
+  typedef GraphQuery::Answer Answer;
+
+  /// Queries answered in parallel at a time by `run`
+  static constexpr size_t BLOCK_SIZE = 4096;
+
+  /// Engine for `g`, with a search workspace for each of `workers` threads
+  QueryEngine( G const& g, size_t const workers ) :
+    _graph(g),
+    _searches(workers),
+    _components_ready(false)
+  {
+    for ( auto& search : _searches )
+      search.reset( new Search( g ) );
+  }
+
+  /// Number of threads that may answer queries at once
+  size_t workers() const { return _searches.size(); }
+
+  /// Answers `query` with the workspace of `worker`, which no other thread
+  /// may be using. A query about a vertex not in the graph is answered
+  /// with an error.
+  Answer answer( Query const& query, size_t const worker )
+  {
+    auto const start = std::chrono::steady_clock::now();
+    Answer answer = Answer();
+    switch ( query.kind ) {
+    case GraphQuery::Kind::Connected:
+    case GraphQuery::Kind::Path:
+      if ( !checkVertex( query.v, answer ) )
+        break;
+      // fall through
+    case GraphQuery::Kind::Reach:
+      if ( checkVertex( query.u, answer ) )
+        answerSearch( query, worker, answer );
+      break;
+    case GraphQuery::Kind::Cycle:
+      std::call_once( _cycle_once, [this] {
+        auto cycle = GraphInfo::findCycle( _graph );
+        if ( cycle )
+          _cycle = std::move( *cycle );
+      } );
+      answer.vertices = _cycle;
+      break;
+    case GraphQuery::Kind::Size:
+      answer.vertex_count = _graph.v();
+      answer.edge_count = _graph.e();
+      break;
+    }
+    answer.seconds = std::chrono::duration<double>( std::chrono::steady_clock::now() - start ).count();
+    return answer;
+  }
+
+  /// Answers every query on the workers of `pool`, which must number no
+  /// more than `workers()`; `answers[i]` is for `queries[i]`
+  std::vector<Answer> answer( std::vector<Query> const& queries, ThreadPool& pool )
+  {
+    std::vector<Answer> answers( queries.size() );
+    pool.parallelFor( queries.size(), [&]( size_t const task, size_t const worker ) {
+      answers[task] = answer( queries[task], worker );
+    } );
+    return answers;
+  }
+
+  /// Answers every query read from `in`, `BLOCK_SIZE` at a time on the
+  /// workers of `pool`, writing the answers to `out` in order, and
+  /// summarizes how long they took
+  LatencySummary run( std::istream& in, std::ostream& out, ThreadPool& pool )
+  {
+    auto const start = std::chrono::steady_clock::now();
+    std::vector<double> latencies;
+
+    // a block of lines: each parses to a query or an error
+    std::vector<Query> queries;
+    std::vector<size_t> line_numbers;
+    std::vector<std::string> errors;
+    std::string line;
+    size_t line_number = 0;
+    bool more = true;
+    while ( more ) {
+      queries.clear();
+      line_numbers.clear();
+      errors.clear();
+      while ( queries.size() < BLOCK_SIZE && (more = bool(std::getline( in, line ))) ) {
+        ++line_number;
+        if ( GraphQuery::isBlank( line ) )
+          continue;
+        try {
+          queries.push_back( GraphQuery::parse( line ) );
+          errors.push_back( std::string() );
+        } catch ( std::invalid_argument const& e ) {
+          queries.push_back( Query() );
+          errors.push_back( e.what() );
+        }
+        line_numbers.push_back( line_number );
+      }
+
+      std::vector<Answer> answers( queries.size() );
+      pool.parallelFor( queries.size(), [&]( size_t const task, size_t const worker ) {
+        if ( errors[task].empty() )
+          answers[task] = answer( queries[task], worker );
+      } );
+
+      for ( size_t i = 0; i < queries.size(); ++i ) {
+        if ( !errors[i].empty() ) {
+          GraphQuery::writeError( out, line_numbers[i], errors[i] );
+          continue;
+        }
+        GraphQuery::write( out, queries[i], answers[i], line_numbers[i] );
+        if ( answers[i].error.empty() )
+          latencies.push_back( answers[i].seconds );
+      }
+    }
+    out.flush();
+
+    double const wall = std::chrono::duration<double>( std::chrono::steady_clock::now() - start ).count();
+    return LatencySummary::of( std::move(latencies), wall );
+  }
+
+private:
+
+  /// Whether `v` is in the graph; if not, says so in `answer`
+  bool checkVertex( size_type const v, Answer& answer ) const
+  {
+    if ( v < _graph.v() )
+      return true;
+    answer.error = "no vertex " + std::to_string(v) + " in the graph";
+    return false;
+  }
+
+  /// Answers a reach, connected or path query, from the component labels
+  /// when they're enough and otherwise by searching from u
+  void answerSearch( Query const& query, size_t const worker, Answer& answer )
+  {
+    if ( query.kind == GraphQuery::Kind::Connected )
+      std::call_once( _components_once, [this] { labelComponents(); } );
+
+    if ( query.kind != GraphQuery::Kind::Path && _components_ready.load( std::memory_order_acquire ) ) {
+      size_type const id = _components->id( query.u );
+      answer.reach = _component_sizes[id];
+      answer.connected = query.kind == GraphQuery::Kind::Connected && _components->id( query.v ) == id;
+      return;
+    }
+
+    Search& search = *_searches[worker];
+    search.search( query.u );
+    answer.reach = search.count();
+    answer.connected = query.kind != GraphQuery::Kind::Reach && search.marked( query.v );
+    if ( query.kind == GraphQuery::Kind::Path && answer.connected ) {
+      for ( V_ID w = query.v; w != query.u; w = search.parent(w) )
+        answer.vertices.push_back( w );
+      answer.vertices.push_back( query.u );
+      std::reverse( answer.vertices.begin(), answer.vertices.end() );
+    }
+  }
+
+  /// Labels every component and counts its vertices
+  void labelComponents()
+  {
+    _components.reset( new ConnectedComponents<G>( _graph, false, std::clog ) );
+    _component_sizes.assign( _components->count(), 0 );
+    for ( V_ID v = 0; v < _graph.v(); ++v )
+      ++_component_sizes[_components->id(v)];
+    _components_ready.store( true, std::memory_order_release );
+  }
+
+  G const& _graph;
+  std::vector<std::unique_ptr<Search>> _searches; ///< one workspace per worker
+
+  std::once_flag _components_once;
+  std::unique_ptr<ConnectedComponents<G>> _components;
+  std::vector<size_type> _component_sizes; ///< vertices in each component
+  std::atomic<bool> _components_ready;     ///< set once the above are filled
+
+  std::once_flag _cycle_once;
+  std::vector<V_ID> _cycle; ///< empty if the graph has no cycle
+};
+
+/// Answers the queries in the file `query_path` ('-' for standard input)
+/// with `engine` on the workers of `pool`, writes the answers to the file
+/// `answer_path` (standard output if empty), and prints their throughput
+/// and latency to standard error. Throws `std::runtime_error` if either
+/// file can't be opened.
+template<class G, class Search>
+void runBatch( QueryEngine<G, Search>& engine, ThreadPool& pool,
+               std::string const& query_path, std::string const& answer_path )
+{
+  std::ifstream query_file;
+  std::ofstream answer_file;
+  if ( query_path != "-" ) {
+    query_file.open( query_path );
+    if ( !query_file )
+      throw std::runtime_error( "Can't open " + query_path );
+  }
+  if ( !answer_path.empty() ) {
+    answer_file.open( answer_path );
+    if ( !answer_file )
+      throw std::runtime_error( "Can't open " + answer_path );
+  }
+
+  std::istream& queries = query_file.is_open() ? static_cast<std::istream&>(query_file) : std::cin;
+  std::ostream& answers = answer_file.is_open() ? static_cast<std::ostream&>(answer_file) : std::cout;
+  std::cerr << engine.run( queries, answers, pool ) << std::flush;
+}
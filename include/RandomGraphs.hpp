@@ -0,0 +1,53 @@
+/** \file RandomGraphs.hpp
+ * Erdős–Rényi random graphs, generated in parallel and reproducibly.
+ *
+ * \author Brian Heim
+ * \date   2026-10-17
+ */
+
+#pragma once
+
+#include "AbstractUGraph.hpp"
+#include "ThreadPool.hpp"
+
+#include <cstddef> // size_t
+#include <cstdint> // uint64_t
+#include <vector>
+
+/// Erdős–Rényi graphs as edge lists, ready for `CSRUGraph`'s chunked
+/// constructor.
+///
+/// The possible edges are numbered row by row: (1, 0), (2, 0), (2, 1),
+/// (3, 0), ..., with (v, v) ending row v when self-loops are allowed. That
+/// range is split into `STREAM_COUNT` equal blocks, each drawn by its own
+/// random stream seeded from the seed and the block, and each block's
+/// edges come out as one chunk in order. So a seed gives the same graph
+/// whatever the number of threads. Edges are `(w, v)` with `w <= v`.
+namespace RandomGraphs {
+
+typedef AbstractUGraph::size_type size_type;
+typedef AbstractUGraph::EdgeList EdgeList;
+
+/// Blocks of possible edges, each with its own random stream
+static constexpr size_t STREAM_COUNT = 256;
+
+/// Number of possible edges between `vertex_count` vertices
+std::uint64_t pairCount( size_type const vertex_count, bool const self_loops );
+
+/// G(n, p): every possible edge present with probability `p`, each
+/// independently. Skips geometrically distributed runs of absent edges, as
+/// Batagelj and Brandes do, so it takes time in the edges made rather than
+/// the pairs considered. Throws `std::domain_error` unless `0 <= p <= 1`.
+std::vector<EdgeList> gnp( size_type const vertex_count, double const p, std::uint64_t const seed,
+                           ThreadPool& pool, bool const self_loops = false );
+
+/// G(n, m): `edge_count` edges, every set of that many possible edges
+/// equally likely. Draws a few more edges than needed, drops repeats by
+/// sorting each block, then drops a random surplus; when more than half the
+/// possible edges are wanted, draws the missing ones instead. With
+/// `multi_edges`, every edge is drawn independently and repeats stay.
+/// Throws `std::domain_error` if there are fewer possible edges than that.
+std::vector<EdgeList> gnm( size_type const vertex_count, size_type const edge_count, std::uint64_t const seed,
+                           ThreadPool& pool, bool const self_loops = false, bool const multi_edges = false );
+
+} // namespace RandomGraphs
@@ -0,0 +1,130 @@
+/** \file SearchTracer.hpp
+  * Tracing policies for the graph searches.
+  *
+  * \author Brian Heim
+  * \date   2026-10-17
+  */
+
+#pragma once
+
+#include <cstddef> // size_t
+#include <cstdint> // uint64_t
+#include <ostream>
+
+/// A search calls its tracer at each step, passing the number of vertices
+/// still waiting in its queue or stack (`pending`) and the vertex involved:
+///
+///   - `begin(source)` when a search starts
+///   - `push(pending, v)` when `v` is first reached
+///   - `pop(pending, v)` when `v` is taken off to be explored
+///   - `examine(pending, v)` for each neighbor `v` of the explored vertex
+///
+/// The tracer is a template parameter, so the calls are resolved at compile
+/// time and `NullTracer` costs nothing at all.
+
+/// Records nothing
+struct NullTracer
+{
+  template<class V> void begin( V ) { }
+  template<class V> void push( size_t, V ) { }
+  template<class V> void pop( size_t, V ) { }
+  template<class V> void examine( size_t, V ) { }
+};
+
+/// Prints each step, indented by the number of pending vertices:
+///
+///     0 push
+///     0 pop
+///     (4)
+///     4 push
+///       (2)
+class TextTracer
+{
+public:
+  explicit TextTracer( std::ostream& os ) : _out(&os) { }
+
+  template<class V> void begin( V ) { }
+
+  template<class V> void push( size_t const pending, V const v )
+  {
+    indent( pending );
+    *_out << v << " push\n";
+  }
+
+  template<class V> void pop( size_t const pending, V const v )
+  {
+    indent( pending );
+    *_out << v << " pop\n";
+  }
+
+  template<class V> void examine( size_t const pending, V const v )
+  {
+    indent( pending );
+    *_out << '(' << v << ")\n";
+  }
+
+private:
+
+  void indent( size_t const pending )
+  {
+    static char const spaces[] = "                                                                ";
+    size_t const width = sizeof(spaces) - 1;
+    for ( size_t count = pending * TAB_SIZE; count > 0; ) {
+      size_t const n = count < width ? count : width;
+      _out->write( spaces, n );
+      count -= n;
+    }
+  }
+
+  std::ostream* _out;
+
+  static const size_t TAB_SIZE = 2;
+};
+
+/// Writes each step as a compact binary record, for offline analysis.
+///
+/// The stream starts with the four bytes "GTR1". Every record is one byte
+/// of `Event`, then `pending` and the vertex as LEB128 varints (low seven
+/// bits first, high bit set on all but the last byte). `Begin` records
+/// have `pending` 0. Open the stream in binary mode.
+class BinaryTracer
+{
+public:
+  enum Event : unsigned char { Begin = 0, Push = 1, Pop = 2, Examine = 3 };
+
+  /// Writes the header to `os`; construct one tracer per stream
+  explicit BinaryTracer( std::ostream& os ) : _out(&os)
+  {
+    _out->write( "GTR1", 4 );
+  }
+
+  template<class V> void begin( V const v ) { record( Begin, 0, v ); }
+  template<class V> void push( size_t const pending, V const v ) { record( Push, pending, v ); }
+  template<class V> void pop( size_t const pending, V const v ) { record( Pop, pending, v ); }
+  template<class V> void examine( size_t const pending, V const v ) { record( Examine, pending, v ); }
+
+private:
+
+  void record( Event const event, std::uint64_t const pending, std::uint64_t const v )
+  {
+    // an event byte and two varints of at most ten bytes each
+    char buffer[21];
+    char* end = buffer;
+    *end++ = char(event);
+    end = encodeVarint( pending, end );
+    end = encodeVarint( v, end );
+    _out->write( buffer, end - buffer );
+  }
+
+  static char* encodeVarint( std::uint64_t value, char* out )
+  {
+    while ( value >= 0x80 ) {
+      *out++ = char(value | 0x80);
+      value >>= 7;
+    }
+    *out++ = char(value);
+    return out;
+  }
+
+  std::ostream* _out;
+};
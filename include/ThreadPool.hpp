@@ -0,0 +1,162 @@
+/** \file ThreadPool.hpp
+ * Fixed-size pool of worker threads for data-parallel loops.
+ *
+ * \author Brian Heim
+ * \date   2026-10-17
+ */
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef> // size_t
+#include <exception> // exception_ptr
+#include <functional> // function
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/// A pool of `size()` workers. The thread calling `parallelFor` is worker 0
+/// and the pool owns the other `size() - 1` threads, so a pool of one runs
+/// everything inline.
+///
+/// `parallelFor` is not reentrant: only one loop may run on a pool at a time.
+class ThreadPool
+{
+public:
+  /// Creates a pool with `thread_count` workers; 0 means one per hardware thread
+  explicit ThreadPool( size_t thread_count = 0 ) :
+    _worker_count(thread_count ? thread_count : defaultThreadCount()),
+    _threads(),
+    _mutex(),
+    _wake(),
+    _done(),
+    _job(nullptr),
+    _task_count(0),
+    _next_task(0),
+    _active(0),
+    _generation(0),
+    _stop(false),
+    _error()
+  {
+    for ( size_t worker = 1; worker < _worker_count; ++worker )
+      _threads.emplace_back( [this, worker]() { workerLoop( worker ); } );
+  }
+
+  ThreadPool( ThreadPool const& ) = delete;
+  ThreadPool& operator=( ThreadPool const& ) = delete;
+
+  ~ThreadPool()
+  {
+    {
+      std::lock_guard<std::mutex> lock( _mutex );
+      _stop = true;
+    }
+    _wake.notify_all();
+    for ( auto& thread : _threads )
+      thread.join();
+  }
+
+  /// Number of workers, including the calling thread
+  size_t size() const { return _worker_count; }
+
+  /// Calls `fn(task, worker)` for every `task` in [0, task_count) and returns
+  /// once all calls have finished. Tasks are handed out dynamically, and
+  /// `worker` is in [0, size()) so callers can keep per-worker buffers.
+  /// The first exception thrown by a task is rethrown here.
+  template<class F>
+  void parallelFor( size_t const task_count, F&& fn )
+  {
+    if ( task_count == 0 )
+      return;
+
+    if ( _threads.empty() || task_count == 1 ) {
+      for ( size_t task = 0; task < task_count; ++task )
+        fn( task, 0 );
+      return;
+    }
+
+    std::function<void(size_t, size_t)> job( std::ref(fn) );
+    {
+      std::lock_guard<std::mutex> lock( _mutex );
+      _job = &job;
+      _task_count = task_count;
+      _next_task.store( 0 );
+      _active = _threads.size();
+      _error = nullptr;
+      ++_generation;
+    }
+    _wake.notify_all();
+
+    runTasks( 0 );
+
+    std::unique_lock<std::mutex> lock( _mutex );
+    _done.wait( lock, [this]() { return _active == 0; } );
+    _job = nullptr;
+    if ( _error )
+      std::rethrow_exception( _error );
+  }
+
+  /// One worker per hardware thread, or one if that is unknown
+  static size_t defaultThreadCount()
+  {
+    unsigned const hardware = std::thread::hardware_concurrency();
+    return hardware ? hardware : 1;
+  }
+
+private:
+
+  void workerLoop( size_t const worker )
+  {
+    size_t seen_generation = 0;
+    while ( true ) {
+      {
+        std::unique_lock<std::mutex> lock( _mutex );
+        _wake.wait( lock, [&]() { return _stop || _generation != seen_generation; } );
+        if ( _stop )
+          return;
+        seen_generation = _generation;
+      }
+
+      runTasks( worker );
+
+      std::lock_guard<std::mutex> lock( _mutex );
+      if ( --_active == 0 )
+        _done.notify_all();
+    }
+  }
+
+  void runTasks( size_t const worker )
+  {
+    while ( true ) {
+      size_t const task = _next_task.fetch_add( 1 );
+      if ( task >= _task_count )
+        return;
+
+      try {
+        (*_job)( task, worker );
+      } catch ( ... ) {
+        std::lock_guard<std::mutex> lock( _mutex );
+        if ( !_error )
+          _error = std::current_exception();
+        // stop handing out work; tasks already running still finish
+        _next_task.store( _task_count );
+      }
+    }
+  }
+
+  size_t _worker_count;
+  std::vector<std::thread> _threads;
+
+  std::mutex _mutex;
+  std::condition_variable _wake; ///< signals workers that a loop started
+  std::condition_variable _done; ///< signals the caller that workers finished
+
+  std::function<void(size_t, size_t)> const* _job;
+  size_t _task_count;
+  std::atomic<size_t> _next_task;
+  size_t _active;      ///< pool threads still working on the current loop
+  size_t _generation;  ///< incremented once per loop
+  bool _stop;
+  std::exception_ptr _error;
+};
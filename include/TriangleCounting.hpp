@@ -0,0 +1,207 @@
+/** \file TriangleCounting.hpp
+  * Triangle counts and clustering coefficients.
+  *
+  * \author Brian Heim
+  * \date   2026-10-17
+  */
+
+#pragma once
+
+#include "AbstractUGraph.hpp"
+#include "AMUGraph.hpp"
+#include "BitKernels.hpp"
+#include "Permutation.hpp"
+#include "SetIntersection.hpp"
+#include "ThreadPool.hpp"
+#include "VertexOrdering.hpp"
+
+#include <algorithm> // lower_bound, min, sort, unique
+#include <atomic>
+#include <cstddef> // size_t
+#include <vector>
+
+/// Per-vertex triangle counts and the statistics that follow from them;
+/// what every `TriangleCounting` answers with
+class TriangleTally
+{
+public:
+  typedef AbstractUGraph::VertexID V_ID;
+  typedef AbstractUGraph::size_type size_type;
+
+  /// Number of triangles in the graph
+  size_type count() const { return _count; }
+
+  /// Number of triangles through `v`
+  size_type triangles( V_ID v ) const { return _triangles[v]; }
+
+  /// Number of distinct neighbors of `v` other than itself
+  size_type degree( V_ID v ) const { return _degrees[v]; }
+
+  /// Fraction of the pairs of `v`'s neighbors that are adjacent, or 0 for
+  /// fewer than two neighbors
+  double clustering( V_ID v ) const
+  {
+    if ( _degrees[v] < 2 )
+      return 0;
+    return double(_triangles[v]) / (double(_degrees[v]) * (_degrees[v] - 1) / 2);
+  }
+
+  /// Mean of `clustering(v)` over every vertex, counting those with fewer
+  /// than two neighbors as 0
+  double averageClustering() const
+  {
+    if ( _triangles.empty() )
+      return 0;
+    double sum = 0;
+    for ( V_ID v = 0; v < _triangles.size(); ++v )
+      sum += clustering( v );
+    return sum / _triangles.size();
+  }
+
+protected:
+
+  /// Vertices per task
+  static constexpr size_t GRAIN = 1024;
+
+  explicit TriangleTally( size_type const vertex_count ) :
+    _triangles(vertex_count, 0),
+    _degrees(vertex_count, 0),
+    _count(0)
+  { }
+
+  /// Calls `fn(v, worker)` for every vertex, in tasks of `GRAIN` vertices
+  template<class F>
+  static void forEachVertex( size_type const vertex_count, ThreadPool& pool, F&& fn )
+  {
+    size_t const tasks = (vertex_count + GRAIN - 1) / GRAIN;
+    pool.parallelFor( tasks, [&]( size_t const task, size_t const worker ) {
+      V_ID const end = std::min<size_type>( vertex_count, (task + 1) * GRAIN );
+      for ( V_ID v = task * GRAIN; v < end; ++v )
+        fn( v, worker );
+    } );
+  }
+
+  std::vector<size_type> _triangles;
+  std::vector<size_type> _degrees;
+  size_type _count;
+};
+
+/// Triangles of a graph with sorted-list intersection, in parallel.
+///
+/// Vertices are ranked by descending degree, and each edge is kept only in
+/// the list of its lower-ranked end, sorted. Every list then holds at most
+/// sqrt(2E) vertices, and each triangle shows up exactly once: at its
+/// lowest-ranked vertex u, as the common part of the lists of u and of
+/// another of its vertices. Lists are intersected by the kernels of
+/// `SetIntersection`.
+///
+/// Self-loops and parallel edges are ignored.
+template<class G> class TriangleCounting : public TriangleTally
+{
+public:
+
+  /// Count the triangles of `g`, using the workers of `pool`
+  TriangleCounting( G const& g, ThreadPool& pool ) :
+    TriangleTally(g.v())
+  {
+    size_type const vertex_count = g.v();
+    Permutation const order = VertexOrdering::degreeOrder( g );
+
+    // each vertex's list: its neighbors of lower rank, by rank. Sized
+    // before duplicates are dropped, so a list may end before the next one
+    // starts.
+    std::vector<size_type> starts( vertex_count + 1, 0 );
+    forEachVertex( vertex_count, pool, [&]( V_ID const u, size_t ) {
+      for ( auto const w : g.neighbors( order.toOld(u) ) )
+        starts[u + 1] += order.toNew(w) < u;
+    } );
+    for ( V_ID u = 0; u < vertex_count; ++u )
+      starts[u + 1] += starts[u];
+
+    std::vector<size_type> ends( vertex_count );
+    std::vector<V_ID> lists( starts[vertex_count] );
+    std::vector<std::vector<V_ID>> scratch( pool.size() );
+    forEachVertex( vertex_count, pool, [&]( V_ID const u, size_t const worker ) {
+      std::vector<V_ID>& neighbors = scratch[worker];
+      neighbors.clear();
+      for ( auto const w : g.neighbors( order.toOld(u) ) )
+        if ( order.toNew(w) != u )
+          neighbors.push_back( order.toNew(w) );
+      std::sort( neighbors.begin(), neighbors.end() );
+      neighbors.erase( std::unique( neighbors.begin(), neighbors.end() ), neighbors.end() );
+
+      _degrees[order.toOld(u)] = neighbors.size();
+      auto const lower_end = std::lower_bound( neighbors.begin(), neighbors.end(), u );
+      ends[u] = std::copy( neighbors.begin(), lower_end, lists.begin() + starts[u] ) - lists.begin();
+    } );
+
+    // credit each triangle to all three of its vertices
+    std::vector<std::atomic<size_type>> counts( vertex_count );
+    for ( auto& c : counts )
+      c.store( 0, std::memory_order_relaxed );
+    std::vector<size_type> totals( pool.size(), 0 );
+    forEachVertex( vertex_count, pool, [&]( V_ID const u, size_t const worker ) {
+      V_ID const* const list = lists.data() + starts[u];
+      size_t const length = ends[u] - starts[u];
+      size_type found = 0;
+      for ( size_t i = 0; i < length; ++i ) {
+        V_ID const v = list[i];
+        size_type const common = SetIntersection::forEachCommon(
+            list, length, lists.data() + starts[v], ends[v] - starts[v], [&]( V_ID const w ) {
+              counts[w].fetch_add( 1, std::memory_order_relaxed );
+            } );
+        if ( common > 0 )
+          counts[v].fetch_add( common, std::memory_order_relaxed );
+        found += common;
+      }
+      if ( found > 0 )
+        counts[u].fetch_add( found, std::memory_order_relaxed );
+      totals[worker] += found;
+    } );
+
+    for ( auto const total : totals )
+      _count += total;
+    for ( V_ID u = 0; u < vertex_count; ++u )
+      _triangles[order.toOld(u)] = counts[u].load( std::memory_order_relaxed );
+  }
+};
+
+/// Triangles of an adjacency matrix by bitset intersection, in parallel.
+///
+/// The neighbors `v` and `w` share are the bits set in both their rows, so
+/// each vertex's triangles are half the sum of one AND-and-count per
+/// neighbor. Vertices are independent and need no synchronization. Suits
+/// dense graphs, where the rows are full enough for the row width to pay.
+///
+/// Self-loops are ignored.
+template<> class TriangleCounting<AMUGraph> : public TriangleTally
+{
+public:
+
+  /// Count the triangles of `g`, using the workers of `pool`
+  TriangleCounting( AMUGraph const& g, ThreadPool& pool ) :
+    TriangleTally(g.v())
+  {
+    size_type const words = g.rowWords();
+    forEachVertex( g.v(), pool, [&]( V_ID const v, size_t ) {
+      AMUGraph::Word const* const row = g.rowData( v );
+      // a self-loop puts v in its own row, so it would look shared with
+      // every neighbor; likewise for each neighbor's own loop
+      size_type const own_loop = g.hasEdge( v, v );
+      _degrees[v] = BitKernels::popcountRange( row, words ) - own_loop;
+
+      size_type twice = 0;
+      for ( auto const w : g.neighbors(v) ) {
+        if ( w == v )
+          continue;
+        twice += BitKernels::andPopcountRange( row, g.rowData(w), words ) - own_loop - g.hasEdge( w, w );
+      }
+      _triangles[v] = twice / 2;
+    } );
+
+    size_type corners = 0;
+    for ( auto const t : _triangles )
+      corners += t;
+    _count = corners / 3;
+  }
+};
@@ -0,0 +1,86 @@
+/** \file UnixSocket.hpp
+ * Stream sockets in the Unix domain, carrying length-prefixed messages.
+ *
+ * \author Brian Heim
+ * \date   2026-10-17
+ */
+
+#pragma once
+
+#include <cstddef> // size_t
+#include <cstdint> // uint32_t
+#include <string> // string
+
+/// A Unix domain stream socket, closed when the object is destroyed.
+/// Throws `std::system_error` if a call on it fails. A peer that has gone
+/// away is such a failure, never a SIGPIPE.
+///
+/// Messages are framed by a four-byte little-endian length followed by
+/// that many bytes.
+class UnixSocket
+{
+public:
+  /// Longest message either end will send or accept
+  static constexpr std::uint32_t MAX_MESSAGE = 1u << 30;
+
+  /// Bytes of the length in front of each message
+  static constexpr size_t HEADER_SIZE = 4;
+
+  /// Length of the message behind the `HEADER_SIZE` bytes at `header`
+  static std::uint32_t messageLength( char const* header );
+
+  /// Socket listening at `path`, replacing any socket file already there.
+  /// Anything else at `path` is left alone, and listening fails.
+  static UnixSocket listen( std::string const& path, int const backlog = 128 );
+
+  /// Socket connected to the one listening at `path`
+  static UnixSocket connect( std::string const& path );
+
+  /// No socket
+  UnixSocket() : _fd(-1) { }
+
+  UnixSocket( UnixSocket&& other ) : _fd(other._fd) { other._fd = -1; }
+  UnixSocket& operator=( UnixSocket&& other );
+
+  UnixSocket( UnixSocket const& ) = delete;
+  UnixSocket& operator=( UnixSocket const& ) = delete;
+
+  ~UnixSocket() { close(); }
+
+  /// Next connection to this listening socket
+  UnixSocket accept() const;
+
+  /// Whether calls that would wait return at once instead; `send` waits
+  /// for room either way
+  void setNonBlocking( bool const non_blocking ) const;
+
+  /// Writes all `size` bytes at `data`
+  void send( char const* data, size_t size ) const;
+
+  /// Reads exactly `size` bytes into `data`. Returns false if the peer
+  /// closed the connection before the first of them.
+  bool receive( char* data, size_t size ) const;
+
+  /// Reads up to `size` bytes into `data` without waiting on a
+  /// non-blocking socket. Returns the number read, 0 if the peer closed
+  /// the connection, or -1 if none are available yet.
+  long receiveAvailable( char* data, size_t size ) const;
+
+  /// Writes `message` with its length in front
+  void sendMessage( std::string const& message ) const;
+
+  /// Reads the next message into `message`. Returns false if the peer
+  /// closed the connection between messages.
+  bool receiveMessage( std::string& message ) const;
+
+  /// Closes the socket, if open
+  void close();
+
+  /// The file descriptor, for polling; -1 if closed
+  int fd() const { return _fd; }
+
+private:
+  explicit UnixSocket( int const fd ) : _fd(fd) { }
+
+  int _fd;
+};
@@ -0,0 +1,176 @@
+/** \file VertexOrdering.hpp
+ * Vertex orderings that improve memory locality, and relabeling of graphs
+ * by them.
+ *
+ * \author Brian Heim
+ * \date   2026-10-17
+ */
+
+#pragma once
+
+#include "ALUGraph.hpp"
+#include "CSRUGraph.hpp"
+#include "Permutation.hpp"
+
+#include <algorithm> // sort, stable_sort, reverse
+#include <cstddef> // size_t
+#include <utility> // move
+#include <vector>
+
+namespace VertexOrdering {
+
+namespace detail {
+
+/// Vertices sorted by degree; ties keep ID order
+template<class G>
+std::vector<typename G::VertexID> byDegree( G const& graph, bool const descending )
+{
+  std::vector<typename G::VertexID> vertices( graph.v() );
+  for ( size_t v = 0; v < vertices.size(); ++v )
+    vertices[v] = v;
+  std::stable_sort( vertices.begin(), vertices.end(), [&]( auto const a, auto const b ) {
+      return descending ? graph.degree(a) > graph.degree(b) : graph.degree(a) < graph.degree(b);
+  } );
+  return vertices;
+}
+
+/// Breadth-first visiting order covering every component. Each component
+/// is entered from the first unvisited vertex of `starts`; with
+/// `by_degree`, each vertex's newly found neighbors are queued in order of
+/// ascending degree, as Cuthill-McKee does.
+template<class G>
+std::vector<typename G::VertexID> breadthFirst( G const& graph,
+                                                std::vector<typename G::VertexID> const& starts,
+                                                bool const by_degree )
+{
+  typedef typename G::VertexID V_ID;
+
+  std::vector<V_ID> order;
+  order.reserve( graph.v() );
+  std::vector<bool> marks( graph.v(), false );
+
+  for ( auto const start : starts ) {
+    if ( marks[start] )
+      continue;
+
+    // `order` doubles as the queue: [head, order.size()) is still to be explored
+    marks[start] = true;
+    order.push_back( start );
+    for ( size_t head = order.size() - 1; head < order.size(); ++head ) {
+      size_t const first_found = order.size();
+      for ( auto const w : graph.neighbors(order[head]) ) {
+        if ( !marks[w] ) {
+          marks[w] = true;
+          order.push_back( w );
+        }
+      }
+      if ( by_degree )
+        std::stable_sort( order.begin() + first_found, order.end(), [&]( V_ID const a, V_ID const b ) {
+            return graph.degree(a) < graph.degree(b);
+        } );
+    }
+  }
+
+  return order;
+}
+
+} // namespace detail
+
+/// Vertices by descending degree, so that hubs share cache lines
+template<class G>
+Permutation degreeOrder( G const& graph )
+{
+  return Permutation( detail::byDegree(graph, true) );
+}
+
+/// Breadth-first order, entering each component at its highest-degree vertex
+template<class G>
+Permutation breadthFirstOrder( G const& graph )
+{
+  return Permutation( detail::breadthFirst(graph, detail::byDegree(graph, true), false) );
+}
+
+/// Reverse Cuthill-McKee: a breadth-first order from a low-degree vertex of
+/// each component, queueing neighbors by ascending degree, then reversed.
+/// Keeps neighbors' IDs close together (low bandwidth).
+template<class G>
+Permutation reverseCuthillMcKee( G const& graph )
+{
+  auto order = detail::breadthFirst( graph, detail::byDegree(graph, false), true );
+  std::reverse( order.begin(), order.end() );
+  return Permutation( std::move(order) );
+}
+
+/// Groups vertices into communities found by label propagation and lays the
+/// communities out one after another, each in breadth-first order.
+///
+/// Every vertex starts in its own community and, for at most `rounds`
+/// passes, joins the community most common among its neighbors (the
+/// smallest on ties). The result is deterministic.
+template<class G>
+Permutation communityOrder( G const& graph, size_t const rounds = 10 )
+{
+  typedef typename G::VertexID V_ID;
+  size_t const vertex_count = graph.v();
+
+  std::vector<V_ID> labels( vertex_count );
+  for ( size_t v = 0; v < vertex_count; ++v )
+    labels[v] = v;
+
+  // votes per label for the current vertex, and the labels that got any
+  std::vector<size_t> votes( vertex_count, 0 );
+  std::vector<V_ID> voted;
+
+  for ( size_t round = 0; round < rounds; ++round ) {
+    bool changed = false;
+    for ( size_t v = 0; v < vertex_count; ++v ) {
+      for ( auto const w : graph.neighbors(v) ) {
+        if ( w == v )
+          continue;
+        if ( votes[labels[w]]++ == 0 )
+          voted.push_back( labels[w] );
+      }
+      if ( voted.empty() )
+        continue;
+
+      V_ID best = voted[0];
+      for ( auto const label : voted )
+        if ( votes[label] > votes[best] || (votes[label] == votes[best] && label < best) )
+          best = label;
+      for ( auto const label : voted )
+        votes[label] = 0;
+      voted.clear();
+
+      if ( best != labels[v] ) {
+        labels[v] = best;
+        changed = true;
+      }
+    }
+    if ( !changed )
+      break;
+  }
+
+  // number the communities as the breadth-first order first meets them,
+  // then stable-sort that order by community
+  auto order = detail::breadthFirst( graph, detail::byDegree(graph, true), false );
+  std::vector<size_t> rank( vertex_count, vertex_count );
+  size_t next_rank = 0;
+  for ( auto const v : order )
+    if ( rank[labels[v]] == vertex_count )
+      rank[labels[v]] = next_rank++;
+  std::stable_sort( order.begin(), order.end(), [&]( V_ID const a, V_ID const b ) {
+      return rank[labels[a]] < rank[labels[b]];
+  } );
+
+  return Permutation( std::move(order) );
+}
+
+/// `graph` with vertex `v` renamed `permutation.toNew(v)`; adjacency lists
+/// come out sorted. Throws `std::invalid_argument` if the sizes differ.
+CSRUGraph relabel( CSRUGraph const& graph, Permutation const& permutation );
+
+/// `graph` with vertex `v` renamed `permutation.toNew(v)`; adjacency lists
+/// come out sorted. Throws `std::invalid_argument` if the sizes differ.
+ALUGraph relabel( ALUGraph const& graph, Permutation const& permutation );
+
+} // namespace VertexOrdering
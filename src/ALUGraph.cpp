@@ -27,6 +27,6 @@ ALUGraph::ALUGraph( istream & in ) : _adjacencies()
   size_type vertex_count, edge_count;
   in >> vertex_count >> edge_count;
 
-  _adjacencies.resize( vertex_count );
+  _adjacencies.resize( checkedVertexCount(vertex_count) );
   readEdges( in, edge_count );
 }
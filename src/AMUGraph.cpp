@@ -22,15 +22,15 @@ using std::vector;
 using std::streamsize;
 using std::string;
 
-AMUGraph::AMUGraph( istream & in ) : _matrix()
+AMUGraph::AMUGraph( istream & in ) : _vertex_count(0), _row_words(0), _bits()
 {
   size_type vertex_count, edge_count;
   in >> vertex_count >> edge_count;
 
   // fill matrix with `false`
-  _matrix.resize( vertex_count );
-  for ( size_type i = 0; i < vertex_count; ++i )
-    _matrix[i].resize( vertex_count, false );
+  _vertex_count = checkedVertexCount( vertex_count );
+  _row_words = BitKernels::paddedWordsFor( vertex_count );
+  _bits.assign( vertex_count * _row_words, 0 );
 
   readEdges( in, edge_count );
 }
@@ -0,0 +1,124 @@
+/** \file BinaryGraphFormat.cpp
+ * Versioned binary graph file holding CSR arrays.
+ *
+ * \author Brian Heim
+ * \date   2026-10-17
+ */
+
+#include "BinaryGraphFormat.hpp"
+#include "MappedFile.hpp"
+
+#include <algorithm> // is_sorted
+#include <cerrno> // errno
+#include <cstring> // memcmp, memcpy
+#include <fstream> // ifstream, ofstream
+#include <memory> // make_shared
+#include <stdexcept> // runtime_error
+#include <string> // string, to_string
+#include <system_error> // system_error
+
+using std::string;
+using std::to_string;
+using std::uint32_t;
+using std::uint64_t;
+
+typedef CSRUGraph::size_type size_type;
+typedef CSRUGraph::VertexID VertexID;
+
+static_assert( sizeof(size_type) == sizeof(uint64_t), "CSR offsets are stored as 64-bit integers" );
+
+namespace {
+
+char const MAGIC[8] = { 'S', 'W', 'G', 'R', 'A', 'P', 'H', '\0' };
+
+void fail( string const& filename, string const& message )
+{
+  throw std::runtime_error( filename + ": " + message );
+}
+
+} // namespace
+
+namespace BinaryGraphFormat {
+
+Header makeHeader( uint64_t const vertex_count, uint64_t const edge_count,
+                   uint64_t const neighbor_count, uint32_t const flags )
+{
+  Header header = Header();
+  std::memcpy( header.magic, MAGIC, sizeof(MAGIC) );
+  header.version = VERSION;
+  header.flags = flags;
+  header.vertex_count = vertex_count;
+  header.edge_count = edge_count;
+  header.neighbor_count = neighbor_count;
+  header.vertex_id_bytes = sizeof(VertexID);
+  header.byte_order = BYTE_ORDER_MARK;
+  return header;
+}
+
+bool isBinaryGraphFile( string const& filename )
+{
+  std::ifstream in( filename, std::ios::binary );
+  char magic[sizeof(MAGIC)];
+  return in.read( magic, sizeof(magic) ) && std::memcmp( magic, MAGIC, sizeof(MAGIC) ) == 0;
+}
+
+void write( CSRUGraph const& graph, string const& filename )
+{
+  bool sorted = true;
+  for ( VertexID v = 0; sorted && v < graph.v(); ++v ) {
+    auto const range = graph.neighbors( v );
+    sorted = std::is_sorted( range.begin(), range.end() );
+  }
+
+  Header const header = makeHeader( graph.v(), graph.e(), graph.neighborCount(), sorted ? SORTED_ADJACENCY : 0 );
+
+  std::ofstream out( filename, std::ios::binary | std::ios::trunc );
+  out.write( reinterpret_cast<char const*>(&header), sizeof(header) );
+  out.write( reinterpret_cast<char const*>(graph.offsetData()), (graph.v() + 1) * sizeof(size_type) );
+  out.write( reinterpret_cast<char const*>(graph.neighborData()), graph.neighborCount() * sizeof(VertexID) );
+  out.close();
+
+  if ( !out )
+    throw std::system_error( errno, std::system_category(), "Can't write " + filename );
+}
+
+CSRUGraph map( string const& filename )
+{
+  auto const file = std::make_shared<MappedFile const>( filename, MappedFile::Access::Random );
+
+  Header header;
+  if ( file->size() < sizeof(header) )
+    fail( filename, "too small to be a binary graph" );
+  std::memcpy( &header, file->data(), sizeof(header) );
+
+  if ( std::memcmp(header.magic, MAGIC, sizeof(MAGIC)) != 0 )
+    fail( filename, "not a binary graph file" );
+  if ( header.byte_order != BYTE_ORDER_MARK )
+    fail( filename, "written on a machine with a different byte order" );
+  if ( header.version != VERSION )
+    fail( filename, "unsupported format version " + to_string(header.version) );
+  if ( header.vertex_id_bytes != sizeof(VertexID) )
+    fail( filename, "uses " + to_string(header.vertex_id_bytes) + "-byte vertex IDs, but this build uses " +
+        to_string(sizeof(VertexID)) );
+
+  // bound the counts by the file first, so the size arithmetic below can't
+  // overflow and let a corrupt header past the check
+  if ( header.vertex_count >= file->size() / sizeof(uint64_t) )
+    fail( filename, "header claims " + to_string(header.vertex_count) + " vertices, more than the file can hold" );
+  if ( header.neighbor_count > file->size() / sizeof(VertexID) )
+    fail( filename, "header claims " + to_string(header.neighbor_count) + " neighbors, more than the file can hold" );
+
+  uint64_t const expected_size = neighborsPosition( header.vertex_count ) + header.neighbor_count * sizeof(VertexID);
+  if ( file->size() < expected_size )
+    fail( filename, "truncated: expected " + to_string(expected_size) + " bytes, found " + to_string(file->size()) );
+
+  auto const offsets = reinterpret_cast<size_type const*>( file->data() + offsetsPosition() );
+  auto const neighbors = reinterpret_cast<VertexID const*>( file->data() + neighborsPosition(header.vertex_count) );
+
+  if ( offsets[0] != 0 || offsets[header.vertex_count] != header.neighbor_count )
+    fail( filename, "offsets array does not match the header" );
+
+  return CSRUGraph( file, offsets, neighbors, header.vertex_count, header.edge_count );
+}
+
+} // namespace BinaryGraphFormat
@@ -8,19 +8,35 @@
 #include "AbstractUGraph.hpp"
 #include "AMUGraph.hpp"
 #include "ALUGraph.hpp"
+#include "BinaryGraphFormat.hpp"
+#include "CSRUGraph.hpp"
+#include "EdgeListLoader.hpp"
+#include "GraphWriter.hpp"
 #include "BreadthFirstSearch.hpp"
+#include "Diameter.hpp"
+#include "DirectionOptimizingBFS.hpp"
+#include "EccentricityBounds.hpp"
+#include "MultiSourceBFS.hpp"
+#include "ParallelBFS.hpp"
+#include "QueryEngine.hpp"
 
 #include <boost/program_options.hpp>
 
+#include <algorithm> // min
+#include <fstream> // ifstream, ofstream
+#include <iomanip> // setw
 #include <iostream>
-#include <fstream> // ifstream
+#include <limits> // numeric_limits
+#include <memory> // unique_ptr
 #include <string> // string
+#include <vector>
 
 using std::string;
-using std::ifstream;
 using std::cin;
+using std::ifstream;
 using std::cout;
 using std::endl;
+using std::vector;
 
 using VertexID = AbstractUGraph::VertexID;
 namespace bpo = boost::program_options;
@@ -29,7 +45,17 @@ void parseProgramOptions( int argc, char **argv, bpo::options_description& desc,
 {
   desc.add_options()
     ("help,h"      , "Show this message")
-    ("input-file,i", "Input file to read")
+    ("input-file,i", "Input file to read, as an edge list or a binary graph")
+    ("direction-optimizing,d", "Switch between top-down and bottom-up steps, and print per-level statistics instead of a trace")
+    ("alpha", bpo::value<double>()->default_value(15), "With -d, go bottom-up when frontier edges exceed unexplored edges / alpha")
+    ("beta" , bpo::value<double>()->default_value(18), "With -d, go back top-down when the frontier has fewer than vertices / beta")
+    ("sources,s", bpo::value<string>(), "Search from every vertex listed in this file at once and print each one's reach and eccentricity")
+    ("distances", "With -s, also print each source's distance to every vertex ('-' if unreached)")
+    ("threads,t", bpo::value<size_t>(), "Search level by level on this many threads (0 for one per hardware thread) and print distances instead of a trace")
+    ("diameter", "Print each component's diameter and bounds on its radius, searching on --threads threads, instead of searching from vertices")
+    ("trace-file", bpo::value<string>(), "Write a binary trace of each search to this file instead of printing it")
+    ("batch,q", bpo::value<string>(), "Answer the reach, connected, path, cycle and size queries in this file ('-' for stdin) on --threads threads, one tab-separated line each, then print throughput and latency to stderr")
+    ("output,o", bpo::value<string>(), "With -q, write the answers to this file instead of stdout")
     ;
 
   // the positional argument is input-file
@@ -43,15 +69,41 @@ void parseProgramOptions( int argc, char **argv, bpo::options_description& desc,
   bpo::notify( vm );
 }
 
-ALUGraph parseGraph( bpo::variables_map& vm )
+CSRUGraph parseGraph( bpo::variables_map& vm )
 {
-  if ( vm.count("input-file") ) {
-    string filename = vm["input-file"].as<string>();
-    ifstream file( filename );
-    return ALUGraph( file );
-  } else {
-    return ALUGraph( cin );
+  try {
+    if ( vm.count("input-file") ) {
+      string filename = vm["input-file"].as<string>();
+      // binary graphs are mapped and used in place; text is parsed in parallel
+      if ( BinaryGraphFormat::isBinaryGraphFile(filename) )
+        return BinaryGraphFormat::map( filename );
+      return EdgeListLoader( filename ).build<CSRUGraph>();
+    } else {
+      return CSRUGraph( cin );
+    }
+  } catch ( std::exception const& e ) {
+    std::cerr << "*** " << e.what() << endl;
+    std::exit( EXIT_FAILURE );
+  }
+}
+
+/// Reads whitespace-separated source vertices from `filename`
+vector<VertexID> readSources( string const& filename, AbstractUGraph::size_type const vertex_count )
+{
+  ifstream in( filename );
+  if ( !in )
+    throw std::runtime_error( "Can't open " + filename );
+
+  vector<VertexID> sources;
+  AbstractUGraph::size_type source;
+  while ( in >> source ) {
+    if ( source >= vertex_count )
+      throw std::out_of_range( filename + ": source " + std::to_string(source) + " is not a vertex of the graph" );
+    sources.push_back( source );
   }
+  if ( !in.eof() )
+    throw std::runtime_error( filename + ": expected a list of vertex IDs" );
+  return sources;
 }
 
 int main( int argc, char **argv )
@@ -66,10 +118,102 @@ int main( int argc, char **argv )
     std::exit( EXIT_SUCCESS );
   }
 
-  ALUGraph ug = parseGraph( vm );
+  CSRUGraph ug = parseGraph( vm );
+
+  if ( vm.count("batch") ) {
+    ThreadPool pool( vm.count("threads") ? vm["threads"].as<size_t>() : 1 );
+    QueryEngine<CSRUGraph> engine( ug, pool.size() );
+    try {
+      runBatch( engine, pool, vm["batch"].as<string>(), vm.count("output") ? vm["output"].as<string>() : string() );
+    } catch ( std::exception const& e ) {
+      std::cerr << "*** " << e.what() << endl;
+      std::exit( EXIT_FAILURE );
+    }
+    std::exit( EXIT_SUCCESS );
+  }
+
+  if ( vm.count("diameter") ) {
+    ThreadPool pool( vm.count("threads") ? vm["threads"].as<size_t>() : 1 );
+    Diameter<CSRUGraph> const diameter( ug, pool );
+    EccentricityBounds<CSRUGraph> const eccentricities( ug, pool );
+
+    // the radius is the smallest eccentricity in the component
+    vector<VertexID> radius_lower( diameter.count(), std::numeric_limits<VertexID>::max() );
+    vector<VertexID> radius_upper( diameter.count(), std::numeric_limits<VertexID>::max() );
+    for ( VertexID v = 0; v < ug.v(); ++v ) {
+      auto const c = diameter.id( v );
+      radius_lower[c] = std::min( radius_lower[c], eccentricities.lower(v) );
+      radius_upper[c] = std::min( radius_upper[c], eccentricities.upper(v) );
+    }
+
+    cout << "component  vertices  diameter  endpoints  radius\n";
+    for ( size_t c = 0; c < diameter.count(); ++c ) {
+      cout << std::setw(9) << c << "  "
+           << std::setw(8) << diameter.componentSize(c) << "  "
+           << std::setw(8) << diameter.diameter(c) << "  "
+           << diameter.endpoints(c).first << "-" << diameter.endpoints(c).second << "  ";
+      if ( radius_lower[c] == radius_upper[c] )
+        cout << radius_lower[c] << "\n";
+      else
+        cout << radius_lower[c] << ".." << radius_upper[c] << "\n";
+    }
+    cout << "The diameter is " << diameter.diameter() << ", found with " << diameter.searchCount()
+         << " searches; the radius bounds took " << eccentricities.searchCount() << endl;
+    std::exit( EXIT_SUCCESS );
+  }
+
+  if ( vm.count("sources") ) {
+    try {
+      vector<VertexID> const sources = readSources( vm["sources"].as<string>(), ug.v() );
+      bool const distances = vm.count("distances");
+      MultiSourceBFS<CSRUGraph> bfs( ug, sources, distances );
+
+      for ( size_t i = 0; i < sources.size(); ++i ) {
+        cout << sources[i] << ": " << bfs.count(i) << " vertices connected, eccentricity " << bfs.eccentricity(i);
+        if ( distances ) {
+          cout << ", distances";
+          for ( VertexID v = 0; v < ug.v(); ++v ) {
+            if ( bfs.distance(i, v) == MultiSourceBFS<CSRUGraph>::UNREACHED )
+              cout << " -";
+            else
+              cout << ' ' << bfs.distance(i, v);
+          }
+        }
+        cout << '\n';
+      }
+    } catch ( std::exception const& e ) {
+      std::cerr << "*** " << e.what() << endl;
+      std::exit( EXIT_FAILURE );
+    }
+    std::exit( EXIT_SUCCESS );
+  }
 
   cout << "The graph is this: " << endl;
-  cout << ug.toString();
+  GraphWriter( cout ).writeAdjacencyLists( ug );
+
+  // one pool serves every parallel search
+  std::unique_ptr<ThreadPool> pool;
+  if ( vm.count("threads") )
+    pool.reset( new ThreadPool( vm["threads"].as<size_t>() ) );
+
+  // one workspace serves every traced search, printing the trace or
+  // writing it to the trace file
+  typedef BreadthFirstSearch<CSRUGraph, TextTracer> TextBFS;
+  typedef BreadthFirstSearch<CSRUGraph, BinaryTracer> BinaryBFS;
+  std::ofstream trace_file;
+  std::unique_ptr<TextBFS> text_bfs;
+  std::unique_ptr<BinaryBFS> binary_bfs;
+  if ( vm.count("trace-file") ) {
+    string const filename = vm["trace-file"].as<string>();
+    trace_file.open( filename, std::ios::binary );
+    if ( !trace_file ) {
+      std::cerr << "*** Can't open " << filename << endl;
+      std::exit( EXIT_FAILURE );
+    }
+    binary_bfs.reset( new BinaryBFS( ug, BinaryTracer( trace_file ) ) );
+  } else {
+    text_bfs.reset( new TextBFS( ug, TextTracer( cout ) ) );
+  }
 
   VertexID v_id;
   while (true) {
@@ -78,10 +222,54 @@ int main( int argc, char **argv )
     if ( !cin )
       break;
 
-    BreadthFirstSearch<ALUGraph> bfs( ug, v_id, true, cout );
+    if ( v_id >= ug.v() ) {
+      cout << "*** No vertex " << v_id << " in the graph" << endl;
+      continue;
+    }
+
+    if ( vm.count("threads") ) {
+      ParallelBFS<CSRUGraph> bfs( ug, v_id, *pool );
+
+      VertexID deepest = v_id;
+      for ( VertexID v = 0; v < ug.v(); ++v )
+        if ( bfs.marked(v) && bfs.distance(v) > bfs.distance(deepest) )
+          deepest = v;
+
+      cout << "Path to the farthest vertex, " << deepest << ", at distance " << bfs.distance(deepest) << ":";
+      for ( VertexID v = deepest; v != v_id; v = bfs.parent(v) )
+        cout << ' ' << v;
+      cout << ' ' << v_id << "\n";
+
+      cout << "There are " << bfs.count() << " vertices connected to " << v_id << endl;
+    } else if ( vm.count("direction-optimizing") ) {
+      typedef DirectionOptimizingBFS<CSRUGraph> DOBFS;
+      DOBFS::Thresholds thresholds;
+      thresholds.alpha = vm["alpha"].as<double>();
+      thresholds.beta = vm["beta"].as<double>();
+      DOBFS bfs( ug, v_id, thresholds );
+
+      cout << "depth  direction  frontier  frontier edges  edges examined\n";
+      for ( auto const& level : bfs.levels() )
+        cout << std::setw(5) << level.depth << "  "
+             << std::setw(9) << (level.direction == DOBFS::Direction::TopDown ? "top-down" : "bottom-up") << "  "
+             << std::setw(8) << level.frontier_size << "  "
+             << std::setw(14) << level.frontier_edges << "  "
+             << std::setw(14) << level.edges_examined << "\n";
+
+      cout << "There are " << bfs.count() << " vertices connected to " << v_id << endl;
+    } else if ( binary_bfs ) {
+      binary_bfs->search( v_id );
+
+      cout << "There are " << binary_bfs->count() << " vertices connected to " << v_id << endl;
+    } else {
+      text_bfs->search( v_id );
 
-    cout << "There are " << bfs.count() << " vertices connected to " << v_id << endl;
+      cout << "There are " << text_bfs->count() << " vertices connected to " << v_id << endl;
+    }
   }
 
+  // exit() skips destructors, so flush the trace here
+  if ( trace_file.is_open() )
+    trace_file.close();
   std::exit( EXIT_SUCCESS );
 }
@@ -0,0 +1,110 @@
+/** \file CSRBuildDriver.cpp
+ * Driver for ExternalCSRBuilder: converts an edge list of any size into a
+ * binary CSR graph file.
+ *
+ * \author Brian Heim
+ * \date   2026-10-17
+ */
+
+#include "ExternalCSRBuilder.hpp"
+
+#include <boost/program_options.hpp>
+
+#include <iostream>
+#include <iomanip> // setprecision
+#include <fstream> // ifstream
+#include <string> // string
+
+using std::string;
+using std::ifstream;
+using std::cin;
+using std::cout;
+using std::clog;
+using std::endl;
+
+namespace bpo = boost::program_options;
+
+void parseProgramOptions( int argc, char **argv, bpo::options_description& desc, bpo::variables_map& vm )
+{
+  desc.add_options()
+    ("help,h"       , "Show this message")
+    ("input-file,i" , bpo::value<string>(), "Edge list to read; standard input if omitted")
+    ("output,o"     , bpo::value<string>(), "Binary graph file to write")
+    ("memory-mb,m"  , bpo::value<size_t>()->default_value(1024), "Memory budget in MiB")
+    ("temp-dir,t"   , bpo::value<string>()->default_value("/tmp"), "Directory for temporary sorted runs")
+    ("quiet,q"      , "Don't report progress")
+    ;
+
+  // the positional argument is input-file
+  bpo::positional_options_description pod;
+  pod.add( "input-file", 1 );
+
+  bpo::store(
+      bpo::command_line_parser(argc, argv).options(desc).positional(pod).run(),
+      vm
+      );
+  bpo::notify( vm );
+}
+
+/// Prints one progress line to the log
+void reportProgress( ExternalCSRBuilder::Progress const& progress )
+{
+  typedef ExternalCSRBuilder::Progress Progress;
+
+  auto percent = []( double done, double total ) { return total > 0 ? 100.0 * done / total : 100.0; };
+
+  clog << std::fixed << std::setprecision(1);
+  switch ( progress.phase ) {
+    case Progress::Reading:
+      clog << "reading: " << progress.edges_read << " / " << progress.edge_count << " edges ("
+           << percent(progress.edges_read, progress.edge_count) << "%), "
+           << progress.runs << " runs spilled" << endl;
+      break;
+    case Progress::Merging:
+      clog << "merging " << progress.runs << " runs: " << progress.arcs_merged << " / " << progress.arcs_total
+           << " arcs (" << percent(progress.arcs_merged, progress.arcs_total) << "%)" << endl;
+      break;
+    case Progress::Done:
+      clog << "done: " << progress.edge_count << " edges" << endl;
+      break;
+  }
+}
+
+int main( int argc, char **argv )
+{
+  bpo::options_description desc( "Allowed options" );
+  bpo::variables_map vm;
+  parseProgramOptions( argc, argv, desc, vm );
+
+  // if help is requested, just print help and exit
+  if ( vm.count("help") ) {
+    cout << desc << endl;
+    std::exit( EXIT_SUCCESS );
+  }
+
+  if ( !vm.count("output") ) {
+    cout << "*** An output file is required" << endl;
+    std::exit( EXIT_FAILURE );
+  }
+
+  try {
+    ExternalCSRBuilder builder( vm["memory-mb"].as<size_t>() << 20, vm["temp-dir"].as<string>() );
+    if ( !vm.count("quiet") )
+      builder.setProgressCallback( reportProgress );
+
+    string const output = vm["output"].as<string>();
+    if ( vm.count("input-file") ) {
+      ifstream file( vm["input-file"].as<string>(), std::ios::binary );
+      if ( !file )
+        throw std::runtime_error( "Can't open " + vm["input-file"].as<string>() );
+      builder.build( file, output );
+    } else {
+      builder.build( cin, output );
+    }
+  } catch ( std::exception const& e ) {
+    std::cerr << "*** " << e.what() << endl;
+    std::exit( EXIT_FAILURE );
+  }
+
+  std::exit( EXIT_SUCCESS );
+}
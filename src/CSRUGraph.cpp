@@ -0,0 +1,138 @@
+/** \file CSRUGraph.cpp
+ * Immutable undirected graph stored in compressed sparse row form.
+ * Based on Sedgewick and Wayne, 4th ed.
+ *
+ * \author Brian Heim
+ * \date   2026-10-17
+ */
+
+#include "CSRUGraph.hpp"
+
+#include <istream> // istream
+#include <stdexcept> // out_of_range
+#include <string> // to_string
+#include <utility> // move
+
+using std::istream;
+using std::make_shared;
+using std::shared_ptr;
+using std::to_string;
+
+CSRUGraph::CSRUGraph( AbstractUGraph const& graph ) :
+  _storage(), _offsets(nullptr), _neighbors(nullptr), _vertex_count(0), _edge_count(0)
+{
+  auto storage = make_shared<Storage>();
+  storage->offsets.reserve( graph.v() + 1 );
+  storage->offsets.push_back( 0 );
+
+  for ( VertexID v = 0; v < graph.v(); ++v ) {
+    AdjacencyList const adj_list = graph.verticesAdjacentTo( v );
+
+    // an adjacency matrix lists a self-loop once, but it counts twice toward
+    // the degree; store it twice so that degree() is the list length
+    bool const duplicate_self_loops = graph.degree( v ) != adj_list.size();
+    for ( auto const w : adj_list ) {
+      storage->neighbors.push_back( w );
+      if ( w == v && duplicate_self_loops )
+        storage->neighbors.push_back( w );
+    }
+
+    storage->offsets.push_back( storage->neighbors.size() );
+  }
+
+  adopt( std::move(storage), graph.e() );
+}
+
+CSRUGraph::CSRUGraph( istream & in ) :
+  _storage(), _offsets(nullptr), _neighbors(nullptr), _vertex_count(0), _edge_count(0)
+{
+  size_type vertex_count, edge_count;
+  in >> vertex_count >> edge_count;
+  checkedVertexCount( vertex_count );
+
+  EdgeList edges;
+  edges.reserve( edge_count );
+  for ( size_type i = 0; i < edge_count; ++i ) {
+    size_type v, w;
+    in >> v >> w;
+    if ( v >= vertex_count || w >= vertex_count )
+      throw std::out_of_range(
+          "Edge (" + to_string(v) + ", " + to_string(w) +
+          ") is out of range for a graph with " + to_string(vertex_count) + " vertices"
+          );
+    edges.emplace_back( v, w );
+  }
+
+  buildFromEdges( vertex_count, &edges, 1 );
+}
+
+CSRUGraph::CSRUGraph( size_type const vertex_count, EdgeList const& edges ) :
+  _storage(), _offsets(nullptr), _neighbors(nullptr), _vertex_count(0), _edge_count(0)
+{
+  buildFromEdges( vertex_count, &edges, 1 );
+}
+
+CSRUGraph::CSRUGraph( size_type const vertex_count, std::vector<EdgeList> const& edge_chunks ) :
+  _storage(), _offsets(nullptr), _neighbors(nullptr), _vertex_count(0), _edge_count(0)
+{
+  buildFromEdges( vertex_count, edge_chunks.data(), edge_chunks.size() );
+}
+
+CSRUGraph::CSRUGraph( shared_ptr<void const> owner,
+                      size_type const* offsets, VertexID const* neighbors,
+                      size_type const vertex_count, size_type const edge_count ) :
+  _storage(std::move(owner)),
+  _offsets(offsets),
+  _neighbors(neighbors),
+  _vertex_count(vertex_count),
+  _edge_count(edge_count)
+{ }
+
+void CSRUGraph::buildFromEdges( size_type const vertex_count, EdgeList const* chunks, size_t const chunk_count )
+{
+  auto storage = make_shared<Storage>();
+  OffsetArray& offsets = storage->offsets;
+  NeighborArray& neighbors = storage->neighbors;
+
+  // count the degree of each vertex, shifted by one so that the prefix sum
+  // below leaves offsets[v] at the start of v's list
+  size_type edge_count = 0;
+  offsets.assign( checkedVertexCount(vertex_count) + 1, 0 );
+  for ( size_t chunk = 0; chunk < chunk_count; ++chunk ) {
+    for ( auto const& edge : chunks[chunk] ) {
+      if ( edge.first >= vertex_count || edge.second >= vertex_count )
+        throw std::out_of_range(
+            "Edge (" + to_string(edge.first) + ", " + to_string(edge.second) +
+            ") is out of range for a graph with " + to_string(vertex_count) + " vertices"
+            );
+      ++offsets[edge.first + 1];
+      ++offsets[edge.second + 1];
+    }
+    edge_count += chunks[chunk].size();
+  }
+
+  for ( size_type i = 1; i <= vertex_count; ++i )
+    offsets[i] += offsets[i-1];
+
+  // scatter the edges in input order, which reproduces the adjacency order
+  // an ALUGraph would have after the same sequence of addEdge calls
+  neighbors.resize( offsets[vertex_count] );
+  OffsetArray cursor( offsets.begin(), offsets.end() - 1 );
+  for ( size_t chunk = 0; chunk < chunk_count; ++chunk ) {
+    for ( auto const& edge : chunks[chunk] ) {
+      neighbors[cursor[edge.first]++] = edge.second;
+      neighbors[cursor[edge.second]++] = edge.first;
+    }
+  }
+
+  adopt( std::move(storage), edge_count );
+}
+
+void CSRUGraph::adopt( shared_ptr<Storage const> storage, size_type const edge_count )
+{
+  _offsets = storage->offsets.data();
+  _neighbors = storage->neighbors.data();
+  _vertex_count = storage->offsets.size() - 1;
+  _edge_count = edge_count;
+  _storage = std::move( storage );
+}
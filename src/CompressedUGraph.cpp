@@ -0,0 +1,157 @@
+/** \file CompressedUGraph.cpp
+ * Immutable undirected graph with gap- and varint-encoded adjacency lists.
+ *
+ * \author Brian Heim
+ * \date   2026-10-17
+ */
+
+#include "CompressedUGraph.hpp"
+#include "ThreadPool.hpp"
+
+#include <algorithm> // lower_bound, min, sort
+#include <cstring> // memcpy
+#include <limits> // numeric_limits
+#include <stdexcept> // overflow_error
+#include <utility> // move
+
+using std::make_shared;
+using std::uint32_t;
+using std::vector;
+
+namespace {
+
+/// Vertex ranges handed to each thread; several per thread even out skew
+size_t const TASKS_PER_THREAD = 8;
+
+} // namespace
+
+CompressedUGraph::CompressedUGraph( CSRUGraph const& graph, size_t const thread_count ) :
+  _storage(), _offsets(nullptr), _bytes(nullptr), _vertex_count(graph.v()), _edge_count(graph.e())
+{
+  auto storage = make_shared<Storage>();
+  OffsetArray& offsets = storage->offsets;
+  offsets.resize( _vertex_count + 1 );
+
+  ThreadPool pool( thread_count );
+  size_t const task_count = std::max<size_t>( 1, std::min<size_t>( _vertex_count, pool.size() * TASKS_PER_THREAD ) );
+
+  // split the vertices so that each task encodes about the same number of neighbors
+  size_type const* const csr_offsets = graph.offsetData();
+  size_type const arc_count = graph.neighborCount();
+  vector<VertexID> boundaries( task_count + 1 );
+  for ( size_t task = 0; task < task_count; ++task )
+    boundaries[task] = std::lower_bound( csr_offsets, csr_offsets + _vertex_count,
+                                         arc_count / task_count * task ) - csr_offsets;
+  boundaries[task_count] = _vertex_count;
+
+  // encode each range into its own buffer, with offsets relative to it
+  vector<ByteArray> buffers( task_count );
+  pool.parallelFor( task_count, [&]( size_t const task, size_t ) {
+    ByteArray& buffer = buffers[task];
+    AdjacencyList sorted;
+    for ( VertexID v = boundaries[task]; v < boundaries[task+1]; ++v ) {
+      CSRUGraph::NeighborRange const range = graph.neighbors( v );
+      sorted.assign( range.begin(), range.end() );
+      std::sort( sorted.begin(), sorted.end() );
+
+      offsets[v] = buffer.size();
+      encodeList( sorted.data(), sorted.data() + sorted.size(), buffer );
+    }
+  } );
+
+  // concatenate the buffers and rebase their offsets
+  vector<size_type> bases( task_count + 1, 0 );
+  for ( size_t task = 0; task < task_count; ++task )
+    bases[task+1] = bases[task] + buffers[task].size();
+
+  storage->bytes.resize( bases[task_count] );
+  pool.parallelFor( task_count, [&]( size_t const task, size_t ) {
+    std::copy( buffers[task].begin(), buffers[task].end(), storage->bytes.begin() + bases[task] );
+    for ( VertexID v = boundaries[task]; v < boundaries[task+1]; ++v )
+      offsets[v] += bases[task];
+    ByteArray().swap( buffers[task] );
+  } );
+  offsets[_vertex_count] = bases[task_count];
+
+  _offsets = storage->offsets.data();
+  _bytes = storage->bytes.data();
+  _storage = std::move( storage );
+}
+
+CompressedUGraph::CompressedUGraph( AbstractUGraph const& graph ) :
+  CompressedUGraph( CSRUGraph(graph) )
+{ }
+
+CompressedUGraph::CompressedUGraph( std::istream & in ) :
+  CompressedUGraph( CSRUGraph(in) )
+{ }
+
+bool CompressedUGraph::hasEdge( VertexID const v, VertexID const w ) const
+{
+  Byte const* skip_table = list( v );
+  size_type const degree = decodeVarint( skip_table );
+  size_type const skip_count = skipEntryCount( degree );
+  Byte const* const data = skip_table + skip_count * SKIP_ENTRY_BYTES;
+
+  // the entries' base vertices ascend; find the last block whose base is
+  // below `w`, since only that block can hold it
+  auto baseOf = [&]( size_type const entry ) {
+    VertexID base;
+    std::memcpy( &base, skip_table + entry * SKIP_ENTRY_BYTES, sizeof(VertexID) );
+    return base;
+  };
+  size_type low = 0, high = skip_count;
+  while ( low < high ) {
+    size_type const middle = low + (high - low) / 2;
+    if ( baseOf(middle) < w )
+      low = middle + 1;
+    else
+      high = middle;
+  }
+  size_type const block = low;
+
+  Byte const* cursor = data;
+  VertexID value = 0;
+  if ( block > 0 ) {
+    uint32_t offset;
+    std::memcpy( &offset, skip_table + (block - 1) * SKIP_ENTRY_BYTES + sizeof(VertexID), sizeof(offset) );
+    cursor = data + offset;
+    value = baseOf( block - 1 );
+  }
+
+  size_type const count = std::min( BLOCK_SIZE, degree - block * BLOCK_SIZE );
+  for ( size_type i = 0; i < count; ++i ) {
+    value += decodeVarint( cursor );
+    if ( value >= w )
+      return value == w;
+  }
+  return false;
+}
+
+void CompressedUGraph::encodeList( VertexID const* first, VertexID const* last, ByteArray& out )
+{
+  size_type const degree = last - first;
+  encodeVarint( degree, out );
+
+  // reserve the skip table; it is filled in as the blocks are written
+  size_type const skip_start = out.size();
+  out.resize( skip_start + skipEntryCount( degree ) * SKIP_ENTRY_BYTES );
+  size_type const data_start = out.size();
+
+  VertexID previous = 0;
+  for ( size_type i = 0; i < degree; ++i ) {
+    if ( i != 0 && i % BLOCK_SIZE == 0 ) {
+      size_type const block_offset = out.size() - data_start;
+      if ( block_offset > std::numeric_limits<uint32_t>::max() )
+        throw std::overflow_error( "CompressedUGraph: adjacency list is too long to index" );
+
+      uint32_t const offset = block_offset;
+      Byte* const entry = out.data() + skip_start + (i / BLOCK_SIZE - 1) * SKIP_ENTRY_BYTES;
+      std::memcpy( entry, &previous, sizeof(VertexID) );
+      std::memcpy( entry + sizeof(VertexID), &offset, sizeof(offset) );
+    }
+
+    encodeVarint( first[i] - previous, out );
+    previous = first[i];
+  }
+}
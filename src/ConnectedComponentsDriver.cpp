@@ -8,19 +8,23 @@
 #include "AbstractUGraph.hpp"
 #include "AMUGraph.hpp"
 #include "ALUGraph.hpp"
+#include "BinaryGraphFormat.hpp"
+#include "CSRUGraph.hpp"
+#include "EdgeListLoader.hpp"
+#include "GraphWriter.hpp"
 #include "ConnectedComponents.hpp"
+#include "ParallelConnectedComponents.hpp"
+#include "ThreadPool.hpp"
 
 #include <boost/program_options.hpp>
 
 #include <iostream>
-#include <fstream> // ifstream
 #include <string> // string
 #include <vector>
 #include <array>
 #include <numeric>
 
 using std::string;
-using std::ifstream;
 using std::cin;
 using std::cout;
 using std::endl;
@@ -34,7 +38,8 @@ void parseProgramOptions( int argc, char **argv, bpo::options_description& desc,
 {
   desc.add_options()
     ("help,h"      , "Show this message")
-    ("input-file,i", "Input file to read")
+    ("input-file,i", "Input file to read, as an edge list or a binary graph")
+    ("threads,t"   , bpo::value<size_t>(), "Find components by parallel union-find on this many threads (0 for one per hardware thread)")
     ;
 
   // the positional argument is input-file
@@ -48,15 +53,34 @@ void parseProgramOptions( int argc, char **argv, bpo::options_description& desc,
   bpo::notify( vm );
 }
 
-ALUGraph parseGraph( bpo::variables_map& vm )
+CSRUGraph parseGraph( bpo::variables_map& vm )
 {
-  if ( vm.count("input-file") ) {
-    string filename = vm["input-file"].as<string>();
-    ifstream file( filename );
-    return ALUGraph( file );
-  } else {
-    return ALUGraph( cin );
+  try {
+    if ( vm.count("input-file") ) {
+      string filename = vm["input-file"].as<string>();
+      // binary graphs are mapped and used in place; text is parsed in parallel
+      if ( BinaryGraphFormat::isBinaryGraphFile(filename) )
+        return BinaryGraphFormat::map( filename );
+      return EdgeListLoader( filename ).build<CSRUGraph>();
+    } else {
+      return CSRUGraph( cin );
+    }
+  } catch ( std::exception const& e ) {
+    std::cerr << "*** " << e.what() << endl;
+    std::exit( EXIT_FAILURE );
+  }
+}
+
+/// The vertices of each component, indexed by component ID
+template<class CC>
+vector<vector<VertexID>> groupComponents( CSRUGraph const& ug, CC const& cc )
+{
+  vector<vector<VertexID>> components(cc.count());
+  for ( VertexID vertex = 0; vertex < ug.v(); ++vertex ) {
+    auto const component = cc.id( vertex );
+    components[component].push_back( vertex );
   }
+  return components;
 }
 
 int main( int argc, char **argv )
@@ -71,21 +95,24 @@ int main( int argc, char **argv )
     std::exit( EXIT_SUCCESS );
   }
 
-  ALUGraph ug = parseGraph( vm );
+  CSRUGraph ug = parseGraph( vm );
 
   cout << "The graph is this: " << endl;
-  cout << ug.toString();
-
-  ConnectedComponents<ALUGraph> cc( ug, true, cout );
-
-  cout << "There are " << cc.count() << " connected components in the graph " << endl;
-
-  vector<vector<VertexID>> components(cc.count());
-  for ( VertexID vertex = 0; vertex < ug.v(); ++vertex ) {
-    auto const component = cc.id( vertex );
-    components[component].push_back( vertex );
+  GraphWriter( cout ).writeAdjacencyLists( ug );
+
+  // both engines number components by their smallest vertex
+  vector<vector<VertexID>> components;
+  if ( vm.count("threads") ) {
+    ThreadPool pool( vm["threads"].as<size_t>() );
+    ParallelConnectedComponents<CSRUGraph> cc( ug, pool );
+    components = groupComponents( ug, cc );
+  } else {
+    ConnectedComponents<CSRUGraph> cc( ug, true, cout );
+    components = groupComponents( ug, cc );
   }
 
+  cout << "There are " << components.size() << " connected components in the graph " << endl;
+
   cout << "\nThese are the components:\n";
 
   for ( vector<vector<VertexID>>::const_iterator compIt = components.cbegin(); compIt != components.cend(); ++compIt ) {
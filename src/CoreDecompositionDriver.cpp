@@ -0,0 +1,125 @@
+/** \file CoreDecompositionDriver.cpp
+ * Driver for CoreDecomposition
+ *
+ * \author Brian Heim
+ * \date   2026-10-17
+ */
+
+#include "AbstractUGraph.hpp"
+#include "BinaryGraphFormat.hpp"
+#include "CSRUGraph.hpp"
+#include "EdgeListLoader.hpp"
+#include "CoreDecomposition.hpp"
+#include "ParallelCoreDecomposition.hpp"
+#include "ThreadPool.hpp"
+
+#include <boost/program_options.hpp>
+
+#include <iomanip> // setw
+#include <iostream>
+#include <string> // string
+#include <vector>
+
+using std::string;
+using std::cin;
+using std::cout;
+using std::endl;
+using std::vector;
+
+using VertexID = AbstractUGraph::VertexID;
+namespace bpo = boost::program_options;
+
+void parseProgramOptions( int argc, char **argv, bpo::options_description& desc, bpo::variables_map& vm )
+{
+  desc.add_options()
+    ("help,h"      , "Show this message")
+    ("input-file,i", "Input file to read, as an edge list or a binary graph")
+    ("threads,t"   , bpo::value<size_t>(), "Peel in parallel on this many threads (0 for one per hardware thread)")
+    ("per-vertex,p", "Also print each vertex's core number")
+    ("order,o"     , "Also print the degeneracy ordering")
+    ;
+
+  // the positional argument is input-file
+  bpo::positional_options_description pod;
+  pod.add( "input-file", 1 );
+
+  bpo::store(
+      bpo::command_line_parser(argc, argv).options(desc).positional(pod).run(),
+      vm
+      );
+  bpo::notify( vm );
+}
+
+CSRUGraph parseGraph( bpo::variables_map& vm )
+{
+  try {
+    if ( vm.count("input-file") ) {
+      string filename = vm["input-file"].as<string>();
+      // binary graphs are mapped and used in place; text is parsed in parallel
+      if ( BinaryGraphFormat::isBinaryGraphFile(filename) )
+        return BinaryGraphFormat::map( filename );
+      return EdgeListLoader( filename ).build<CSRUGraph>();
+    } else {
+      return CSRUGraph( cin );
+    }
+  } catch ( std::exception const& e ) {
+    std::cerr << "*** " << e.what() << endl;
+    std::exit( EXIT_FAILURE );
+  }
+}
+
+/// Prints how many vertices have each core number, then what was asked for
+template<class CD>
+void printCores( CSRUGraph const& ug, CD const& cd, bool const per_vertex, bool const order )
+{
+  vector<VertexID> sizes( size_t(cd.degeneracy()) + 1, 0 );
+  for ( VertexID v = 0; v < ug.v(); ++v )
+    ++sizes[cd.core(v)];
+
+  cout << "The degeneracy is " << cd.degeneracy() << "\n";
+  cout << "\ncore  vertices\n";
+  for ( size_t k = 0; k < sizes.size(); ++k )
+    if ( sizes[k] > 0 )
+      cout << std::setw(4) << k << "  " << std::setw(8) << sizes[k] << "\n";
+
+  if ( per_vertex ) {
+    cout << "\nvertex  core\n";
+    for ( VertexID v = 0; v < ug.v(); ++v )
+      cout << std::setw(6) << v << "  " << std::setw(4) << cd.core(v) << "\n";
+  }
+
+  if ( order ) {
+    cout << "\nDegeneracy ordering:";
+    for ( auto const v : cd.order() )
+      cout << " " << v;
+    cout << "\n";
+  }
+  cout << std::flush;
+}
+
+int main( int argc, char **argv )
+{
+  bpo::options_description desc( "Allowed options" );
+  bpo::variables_map vm;
+  parseProgramOptions( argc, argv, desc, vm );
+
+  // if help is requested, just print help and exit
+  if ( vm.count("help") ) {
+    cout << desc << endl;
+    std::exit( EXIT_SUCCESS );
+  }
+
+  CSRUGraph ug = parseGraph( vm );
+  bool const per_vertex = vm.count("per-vertex");
+  bool const order = vm.count("order");
+
+  // both engines give the same core numbers
+  if ( vm.count("threads") ) {
+    ThreadPool pool( vm["threads"].as<size_t>() );
+    printCores( ug, ParallelCoreDecomposition<CSRUGraph>( ug, pool ), per_vertex, order );
+  } else {
+    printCores( ug, CoreDecomposition<CSRUGraph>( ug ), per_vertex, order );
+  }
+
+  std::exit( EXIT_SUCCESS );
+}
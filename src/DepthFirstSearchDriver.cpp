@@ -8,19 +8,29 @@
 #include "AbstractUGraph.hpp"
 #include "AMUGraph.hpp"
 #include "ALUGraph.hpp"
+#include "BinaryGraphFormat.hpp"
+#include "Biconnectivity.hpp"
+#include "CSRUGraph.hpp"
+#include "EdgeListLoader.hpp"
+#include "GraphWriter.hpp"
 #include "DepthFirstSearch.hpp"
+#include "MultiSourceBFS.hpp"
+#include "QueryEngine.hpp"
+#include "ThreadPool.hpp"
 
 #include <boost/program_options.hpp>
 
+#include <fstream> // ifstream, ofstream
 #include <iostream>
-#include <fstream> // ifstream
 #include <string> // string
+#include <vector>
 
 using std::string;
-using std::ifstream;
 using std::cin;
+using std::ifstream;
 using std::cout;
 using std::endl;
+using std::vector;
 
 using VertexID = AbstractUGraph::VertexID;
 namespace bpo = boost::program_options;
@@ -29,8 +39,14 @@ void parseProgramOptions( int argc, char **argv, bpo::options_description& desc,
 {
   desc.add_options()
     ("help,h"      , "Show this message")
-    ("input-file,i", "Input file to read")
+    ("input-file,i", "Input file to read, as an edge list or a binary graph")
     ("log,l"       , "Enable logging")
+    ("trace-file"  , bpo::value<string>(), "Write a binary trace of each search to this file")
+    ("sources,s"   , bpo::value<string>(), "Answer for every vertex listed in this file at once, with a multi-source BFS")
+    ("biconnected,b", "Print the bridges, articulation points and biconnected components instead")
+    ("batch,q"     , bpo::value<string>(), "Answer the reach, connected, path, cycle and size queries in this file ('-' for stdin) on --threads threads, one tab-separated line each, then print throughput and latency to stderr")
+    ("output,o"    , bpo::value<string>(), "With -q, write the answers to this file instead of stdout")
+    ("threads,t"   , bpo::value<size_t>()->default_value(1), "With -q, worker threads; 0 means one per hardware thread")
     ;
 
   // the positional argument is input-file
@@ -44,14 +60,57 @@ void parseProgramOptions( int argc, char **argv, bpo::options_description& desc,
   bpo::notify( vm );
 }
 
-ALUGraph parseGraph( bpo::variables_map& vm )
+CSRUGraph parseGraph( bpo::variables_map& vm )
 {
-  if ( vm.count("input-file") ) {
-    string filename = vm["input-file"].as<string>();
-    ifstream file( filename );
-    return ALUGraph( file );
-  } else {
-    return ALUGraph( cin );
+  try {
+    if ( vm.count("input-file") ) {
+      string filename = vm["input-file"].as<string>();
+      // binary graphs are mapped and used in place; text is parsed in parallel
+      if ( BinaryGraphFormat::isBinaryGraphFile(filename) )
+        return BinaryGraphFormat::map( filename );
+      return EdgeListLoader( filename ).build<CSRUGraph>();
+    } else {
+      return CSRUGraph( cin );
+    }
+  } catch ( std::exception const& e ) {
+    std::cerr << "*** " << e.what() << endl;
+    std::exit( EXIT_FAILURE );
+  }
+}
+
+/// Reads whitespace-separated source vertices from `filename`
+vector<VertexID> readSources( string const& filename, AbstractUGraph::size_type const vertex_count )
+{
+  ifstream in( filename );
+  if ( !in )
+    throw std::runtime_error( "Can't open " + filename );
+
+  vector<VertexID> sources;
+  AbstractUGraph::size_type source;
+  while ( in >> source ) {
+    if ( source >= vertex_count )
+      throw std::out_of_range( filename + ": source " + std::to_string(source) + " is not a vertex of the graph" );
+    sources.push_back( source );
+  }
+  if ( !in.eof() )
+    throw std::runtime_error( filename + ": expected a list of vertex IDs" );
+  return sources;
+}
+
+/// Searches from each vertex read from stdin until a non-number
+template<class Search>
+void answerQueries( Search& dfs )
+{
+  VertexID v_id;
+  while (true) {
+    cout << "Enter the vertex to search with, or a non-number to quit: ";
+    cin >> v_id;
+    if ( !cin )
+      break;
+
+    dfs.search( v_id );
+
+    cout << "There are " << dfs.count() << " vertices connected to " << v_id << endl;
   }
 }
 
@@ -67,22 +126,74 @@ int main( int argc, char **argv )
     std::exit( EXIT_SUCCESS );
   }
 
-  ALUGraph ug = parseGraph( vm );
-
-  cout << "The graph is this: " << endl;
-  cout << ug.toString();
+  CSRUGraph ug = parseGraph( vm );
+
+  if ( vm.count("batch") ) {
+    ThreadPool pool( vm["threads"].as<size_t>() );
+    QueryEngine<CSRUGraph, DepthFirstSearch<CSRUGraph>> engine( ug, pool.size() );
+    try {
+      runBatch( engine, pool, vm["batch"].as<string>(), vm.count("output") ? vm["output"].as<string>() : string() );
+    } catch ( std::exception const& e ) {
+      std::cerr << "*** " << e.what() << endl;
+      std::exit( EXIT_FAILURE );
+    }
+    std::exit( EXIT_SUCCESS );
+  }
 
-  VertexID v_id;
-  while (true) {
-    cout << "Enter the vertex to search with, or a non-number to quit: ";
-    cin >> v_id;
-    if ( !cin )
-      break;
+  if ( vm.count("biconnected") ) {
+    Biconnectivity<CSRUGraph> const bc( ug );
+
+    cout << "Bridges:";
+    for ( auto const& bridge : bc.bridges() )
+      cout << " " << bridge.first << "-" << bridge.second;
+    cout << "\nArticulation points:";
+    for ( auto const v : bc.articulationPoints() )
+      cout << " " << v;
+    cout << "\nThere are " << bc.componentCount() << " biconnected components:\n";
+    for ( size_t i = 0; i < bc.componentCount(); ++i ) {
+      cout << i << " |";
+      for ( auto const v : bc.component(i) )
+        cout << " " << v;
+      cout << "\n";
+    }
+    std::exit( EXIT_SUCCESS );
+  }
 
-    bool doLogging = vm.count("log");
-    DepthFirstSearch<ALUGraph> dfs( ug, v_id, doLogging, cout );
+  // a depth-first search reaches the same vertices as a breadth-first one,
+  // so batches are answered by searching from all of them at once
+  if ( vm.count("sources") ) {
+    try {
+      vector<VertexID> const sources = readSources( vm["sources"].as<string>(), ug.v() );
+      MultiSourceBFS<CSRUGraph> search( ug, sources );
+      for ( size_t i = 0; i < sources.size(); ++i )
+        cout << "There are " << search.count(i) << " vertices connected to " << sources[i] << '\n';
+    } catch ( std::exception const& e ) {
+      std::cerr << "*** " << e.what() << endl;
+      std::exit( EXIT_FAILURE );
+    }
+    std::exit( EXIT_SUCCESS );
+  }
 
-    cout << "There are " << dfs.count() << " vertices connected to " << v_id << endl;
+  cout << "The graph is this: " << endl;
+  GraphWriter( cout ).writeAdjacencyLists( ug );
+
+  // one workspace serves every search; the tracer is chosen at compile
+  // time, so an untraced search pays nothing for it
+  if ( vm.count("trace-file") ) {
+    string const filename = vm["trace-file"].as<string>();
+    std::ofstream trace_file( filename, std::ios::binary );
+    if ( !trace_file ) {
+      std::cerr << "*** Can't open " << filename << endl;
+      std::exit( EXIT_FAILURE );
+    }
+    DepthFirstSearch<CSRUGraph, BinaryTracer> dfs( ug, BinaryTracer( trace_file ) );
+    answerQueries( dfs );
+  } else if ( vm.count("log") ) {
+    DepthFirstSearch<CSRUGraph, TextTracer> dfs( ug, TextTracer( cout ) );
+    answerQueries( dfs );
+  } else {
+    DepthFirstSearch<CSRUGraph> dfs( ug );
+    answerQueries( dfs );
   }
 
   std::exit( EXIT_SUCCESS );
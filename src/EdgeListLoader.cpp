@@ -0,0 +1,186 @@
+/** \file EdgeListLoader.cpp
+ * Parallel loader for the edge-list text format.
+ *
+ * \author Brian Heim
+ * \date   2026-10-17
+ */
+
+#include "EdgeListLoader.hpp"
+#include "MappedFile.hpp"
+#include "ThreadPool.hpp"
+
+#include <algorithm> // count, min, max
+#include <charconv> // from_chars
+#include <cstring> // memchr
+#include <stdexcept> // runtime_error
+#include <string> // string, to_string
+#include <system_error> // errc
+
+using std::string;
+using std::to_string;
+using std::vector;
+
+typedef EdgeListLoader::size_type size_type;
+
+namespace {
+
+/// Aim for chunks of at least this many bytes so small files stay cheap
+size_t const MIN_CHUNK_BYTES = 1 << 20;
+
+/// Chunks per thread; more than one evens out uneven lines
+size_t const CHUNKS_PER_THREAD = 4;
+
+/// First error found in a chunk; `position` is a byte offset into the file
+struct ParseError
+{
+  bool found = false;
+  size_t position = 0;
+  string message;
+};
+
+inline bool isBlank( char const c ) { return c == ' ' || c == '\t' || c == '\r'; }
+
+inline bool isSpace( char const c ) { return isBlank( c ) || c == '\n'; }
+
+/// Parses an unsigned decimal at `p`, advancing past it. Returns an error
+/// message, or an empty string on success.
+string parseNumber( char const*& p, char const* const end, size_type& value )
+{
+  auto const result = std::from_chars( p, end, value );
+  if ( result.ec == std::errc::invalid_argument )
+    return "expected a non-negative integer";
+  if ( result.ec == std::errc::result_out_of_range )
+    return "integer is too large";
+
+  p = result.ptr;
+  return string();
+}
+
+/// Parses the `v w` lines in [first, last), which begins at a line start
+void parseChunk( char const* const file_start, char const* first, char const* const last,
+                 size_type const vertex_count, EdgeListLoader::EdgeList& edges, ParseError& error )
+{
+  auto fail = [&]( char const* where, string const& message ) {
+    error.found = true;
+    error.position = where - file_start;
+    error.message = message;
+  };
+
+  char const* p = first;
+  while ( true ) {
+    while ( p != last && isSpace(*p) )
+      ++p;
+    if ( p == last )
+      return;
+
+    size_type endpoints[2];
+    for ( int i = 0; i < 2; ++i ) {
+      if ( i == 1 ) {
+        // the second vertex must be on the same line, after some blanks
+        char const* const blanks_start = p;
+        while ( p != last && isBlank(*p) )
+          ++p;
+        if ( p == blanks_start || p == last || *p == '\n' )
+          return fail( p, "expected two vertex IDs on the line" );
+      }
+
+      char const* const number_start = p;
+      string const message = parseNumber( p, last, endpoints[i] );
+      if ( !message.empty() )
+        return fail( number_start, message );
+      if ( endpoints[i] >= vertex_count )
+        return fail( number_start,
+            "vertex ID " + to_string(endpoints[i]) + " is out of range for a graph with " +
+            to_string(vertex_count) + " vertices" );
+    }
+
+    // nothing but blanks may follow on the line
+    while ( p != last && isBlank(*p) )
+      ++p;
+    if ( p != last && *p != '\n' )
+      return fail( p, "unexpected text after the second vertex ID" );
+
+    edges.emplace_back( endpoints[0], endpoints[1] );
+  }
+}
+
+/// Start of the line after the one containing `p`, or `last`
+char const* nextLineStart( char const* const p, char const* const last )
+{
+  if ( p >= last )
+    return last;
+  char const* const newline = static_cast<char const*>( std::memchr(p, '\n', last - p) );
+  return newline ? newline + 1 : last;
+}
+
+/// Formats `filename:line: message` for a byte offset into the file
+string describeError( MappedFile const& file, size_t const position, string const& message )
+{
+  size_t const line = 1 + std::count( file.data(), file.data() + position, '\n' );
+  return file.filename() + ":" + to_string(line) + ": " + message;
+}
+
+} // namespace
+
+EdgeListLoader::EdgeListLoader( string const& filename, size_t const thread_count ) :
+  _vertex_count(0),
+  _edge_count(0),
+  _chunks()
+{
+  MappedFile const file( filename );
+  char const* const file_start = file.data();
+  char const* const file_end = file.data() + file.size();
+
+  // header: vertex count and edge count
+  char const* p = file_start;
+  size_type declared_edges = 0;
+  size_type* const header[2] = { &_vertex_count, &declared_edges };
+  for ( auto const field : header ) {
+    while ( p != file_end && isSpace(*p) )
+      ++p;
+    string const message = parseNumber( p, file_end, *field );
+    if ( !message.empty() )
+      throw std::runtime_error( describeError(file, p - file_start, "bad header: " + message) );
+  }
+
+  if ( _vertex_count > AbstractUGraph::MAX_VERTEX_COUNT )
+    throw std::runtime_error( describeError(file, 0,
+        to_string(_vertex_count) + " vertices don't fit in " + to_string(8 * sizeof(AbstractUGraph::VertexID)) +
+        "-bit vertex IDs") );
+
+  char const* const body = nextLineStart( p, file_end );
+  size_t const body_size = file_end - body;
+
+  ThreadPool pool( thread_count );
+  size_t const chunk_count = std::max<size_t>( 1,
+      std::min( pool.size() * CHUNKS_PER_THREAD, body_size / MIN_CHUNK_BYTES ) );
+
+  // split at line starts so each chunk can be parsed on its own
+  vector<char const*> boundaries( chunk_count + 1 );
+  boundaries[0] = body;
+  for ( size_t i = 1; i < chunk_count; ++i )
+    boundaries[i] = std::max( boundaries[i-1],
+        nextLineStart( body + body_size / chunk_count * i - 1, file_end ) );
+  boundaries[chunk_count] = file_end;
+
+  _chunks.resize( chunk_count );
+  vector<ParseError> errors( chunk_count );
+  pool.parallelFor( chunk_count, [&]( size_t const chunk, size_t ) {
+    // "v w\n" is at least four bytes; typical lines are a few times longer
+    _chunks[chunk].reserve( (boundaries[chunk+1] - boundaries[chunk]) / 8 );
+    parseChunk( file_start, boundaries[chunk], boundaries[chunk+1], _vertex_count, _chunks[chunk], errors[chunk] );
+  } );
+
+  // report the error nearest the start of the file
+  for ( auto const& error : errors )
+    if ( error.found )
+      throw std::runtime_error( describeError(file, error.position, error.message) );
+
+  for ( auto const& chunk : _chunks )
+    _edge_count += chunk.size();
+
+  if ( _edge_count != declared_edges )
+    throw std::runtime_error(
+        filename + ": header declares " + to_string(declared_edges) +
+        " edges but the file contains " + to_string(_edge_count) );
+}
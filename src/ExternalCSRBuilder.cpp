@@ -0,0 +1,433 @@
+/** \file ExternalCSRBuilder.cpp
+ * Builds a binary CSR graph file from an edge list that may be larger
+ * than memory.
+ *
+ * \author Brian Heim
+ * \date   2026-10-17
+ */
+
+#include "ExternalCSRBuilder.hpp"
+#include "BinaryGraphFormat.hpp"
+
+#include <algorithm> // sort, min, max
+#include <cerrno> // errno
+#include <cstring> // memcpy
+#include <functional> // greater
+#include <limits> // numeric_limits
+#include <queue> // priority_queue
+#include <stdexcept> // invalid_argument, runtime_error
+#include <string> // string, to_string
+#include <system_error> // system_error
+#include <utility> // pair, move, swap
+#include <vector> // vector
+
+#include <fcntl.h> // open
+#include <stdlib.h> // mkstemp
+#include <unistd.h> // pread, pwrite, close, unlink
+
+using std::string;
+using std::to_string;
+using std::uint64_t;
+using std::vector;
+
+typedef ExternalCSRBuilder::VertexID VertexID;
+
+namespace {
+
+/// A directed copy of an edge; runs are sorted by (source, target)
+typedef std::pair<VertexID, VertexID> Arc;
+
+/// Size of the fixed input and output buffers
+size_t const IO_BUFFER_BYTES = 1 << 20;
+
+/// Smallest per-run read buffer during a merge; bounds the merge fan-in
+size_t const MIN_RUN_BUFFER_BYTES = 64 << 10;
+
+/// How often, in edges or arcs, progress is reported
+uint64_t const PROGRESS_INTERVAL = 1 << 22;
+
+[[noreturn]] void throwSystemError( string const& what )
+{
+  throw std::system_error( errno, std::system_category(), what );
+}
+
+/// Owns a file descriptor
+class FileDescriptor
+{
+public:
+  explicit FileDescriptor( int const fd = -1 ) : _fd(fd) { }
+  FileDescriptor( FileDescriptor&& other ) : _fd(other._fd) { other._fd = -1; }
+  FileDescriptor& operator=( FileDescriptor&& other ) { std::swap( _fd, other._fd ); return *this; }
+  ~FileDescriptor() { if ( _fd >= 0 ) ::close( _fd ); }
+
+  int get() const { return _fd; }
+
+private:
+  int _fd;
+};
+
+/// Creates a temporary file that is removed as soon as it is closed
+FileDescriptor createTempFile( string const& directory )
+{
+  string path = directory + "/csr_build.XXXXXX";
+  int const fd = ::mkstemp( &path[0] );
+  if ( fd < 0 )
+    throwSystemError( "Can't create a temporary file in " + directory );
+  ::unlink( path.c_str() );
+  return FileDescriptor( fd );
+}
+
+/// Writes sequentially from a given file position through a fixed buffer
+class BufferedWriter
+{
+public:
+  BufferedWriter( int const fd, uint64_t const position ) :
+    _fd(fd), _position(position), _buffer() { _buffer.reserve( IO_BUFFER_BYTES ); }
+
+  void write( void const* data, size_t const size )
+  {
+    if ( _buffer.size() + size > IO_BUFFER_BYTES )
+      flush();
+    // a block at least as big as the buffer goes straight out, uncopied,
+    // so spilling a run doesn't double its memory
+    if ( size >= IO_BUFFER_BYTES ) {
+      writeThrough( data, size );
+      return;
+    }
+    char const* bytes = static_cast<char const*>( data );
+    _buffer.insert( _buffer.end(), bytes, bytes + size );
+  }
+
+  template<class T>
+  void writeValue( T const& value ) { write( &value, sizeof(value) ); }
+
+  void flush()
+  {
+    writeThrough( _buffer.data(), _buffer.size() );
+    _buffer.clear();
+  }
+
+private:
+  /// Writes `size` bytes at the current position
+  void writeThrough( void const* data, size_t const size )
+  {
+    char const* bytes = static_cast<char const*>( data );
+    size_t done = 0;
+    while ( done < size ) {
+      ssize_t const n = ::pwrite( _fd, bytes + done, size - done, _position + done );
+      if ( n < 0 )
+        throwSystemError( "Write failed" );
+      done += n;
+    }
+    _position += done;
+  }
+
+  int _fd;
+  uint64_t _position;
+  vector<char> _buffer;
+};
+
+/// A sorted run of arcs in a temporary file
+struct Run
+{
+  FileDescriptor file;
+  uint64_t arc_count;
+};
+
+/// Reads the arcs of a run back through a buffer of a given size
+class RunReader
+{
+public:
+  RunReader( Run const& run, size_t const buffer_bytes ) :
+    _fd(run.file.get()),
+    _remaining(run.arc_count),
+    _position(0),
+    _buffer(std::max<size_t>(1, buffer_bytes / sizeof(Arc))),
+    _index(0),
+    _size(0)
+  { }
+
+  /// Reads the next arc into `arc`; false at the end of the run
+  bool next( Arc& arc )
+  {
+    if ( _index == _size && !refill() )
+      return false;
+    arc = _buffer[_index++];
+    return true;
+  }
+
+private:
+  bool refill()
+  {
+    if ( _remaining == 0 )
+      return false;
+
+    size_t const count = std::min<uint64_t>( _buffer.size(), _remaining );
+    char* const bytes = reinterpret_cast<char*>( _buffer.data() );
+    size_t done = 0;
+    while ( done < count * sizeof(Arc) ) {
+      ssize_t const n = ::pread( _fd, bytes + done, count * sizeof(Arc) - done, _position + done );
+      if ( n <= 0 )
+        throwSystemError( "Reading a temporary run failed" );
+      done += n;
+    }
+
+    _position += done;
+    _remaining -= count;
+    _index = 0;
+    _size = count;
+    return true;
+  }
+
+  int _fd;
+  uint64_t _remaining;
+  uint64_t _position;
+  vector<Arc> _buffer;
+  size_t _index;
+  size_t _size;
+};
+
+/// Whitespace-separated unsigned integers from a stream, through a fixed buffer
+class NumberReader
+{
+public:
+  explicit NumberReader( std::istream& in ) : _in(in), _buffer(IO_BUFFER_BYTES), _pos(0), _len(0) { }
+
+  /// Reads the next number; false at end of input. Throws on anything that
+  /// is not a non-negative integer.
+  bool next( uint64_t& value )
+  {
+    int c;
+    do {
+      c = get();
+    } while ( c == ' ' || c == '\t' || c == '\r' || c == '\n' );
+
+    if ( c < 0 )
+      return false;
+    if ( c < '0' || c > '9' )
+      throw std::runtime_error( string("expected a non-negative integer, found '") + char(c) + "'" );
+
+    value = 0;
+    for ( ; c >= '0' && c <= '9'; c = get() ) {
+      uint64_t const digit = c - '0';
+      if ( value > (std::numeric_limits<uint64_t>::max() - digit) / 10 )
+        throw std::runtime_error( "integer is too large" );
+      value = value * 10 + digit;
+    }
+    return true;
+  }
+
+private:
+  int get()
+  {
+    if ( _pos == _len ) {
+      _in.read( _buffer.data(), _buffer.size() );
+      _len = _in.gcount();
+      _pos = 0;
+      if ( _len == 0 )
+        return -1;
+    }
+    return static_cast<unsigned char>( _buffer[_pos++] );
+  }
+
+  std::istream& _in;
+  vector<char> _buffer;
+  size_t _pos;
+  size_t _len;
+};
+
+/// Pops arcs in sorted order from several runs at once
+class RunMerger
+{
+public:
+  RunMerger( vector<Run>::const_iterator first, vector<Run>::const_iterator last, size_t const buffer_bytes ) :
+    _readers(), _heap(), _total(0)
+  {
+    size_t const per_run = buffer_bytes / std::max<size_t>( 1, last - first );
+    for ( auto it = first; it != last; ++it ) {
+      _readers.emplace_back( *it, per_run );
+      _total += it->arc_count;
+    }
+
+    for ( size_t i = 0; i < _readers.size(); ++i )
+      pushFrom( i );
+  }
+
+  bool next( Arc& arc )
+  {
+    if ( _heap.empty() )
+      return false;
+    arc = _heap.top().first;
+    size_t const run = _heap.top().second;
+    _heap.pop();
+    pushFrom( run );
+    return true;
+  }
+
+  uint64_t total() const { return _total; }
+
+private:
+  typedef std::pair<Arc, size_t> Entry;
+
+  void pushFrom( size_t const run )
+  {
+    Arc arc;
+    if ( _readers[run].next(arc) )
+      _heap.emplace( arc, run );
+  }
+
+  vector<RunReader> _readers;
+  std::priority_queue<Entry, vector<Entry>, std::greater<Entry>> _heap;
+  uint64_t _total;
+};
+
+} // namespace
+
+ExternalCSRBuilder::ExternalCSRBuilder( size_t const memory_budget, string const& temp_directory ) :
+  _memory_budget(memory_budget),
+  _temp_directory(temp_directory),
+  _progress()
+{
+  if ( memory_budget < MIN_MEMORY_BUDGET )
+    throw std::invalid_argument( "memory budget must be at least " + to_string(MIN_MEMORY_BUDGET) + " bytes" );
+}
+
+void ExternalCSRBuilder::build( std::istream& in, string const& output_filename )
+{
+  Progress progress = Progress();
+  auto report = [&]( Progress::Phase const phase ) {
+    progress.phase = phase;
+    if ( _progress )
+      _progress( progress );
+  };
+
+  //--------- Pass 1: read edges, spill sorted runs ---------//
+
+  NumberReader reader( in );
+  uint64_t vertex_count, edge_count;
+  if ( !reader.next(vertex_count) || !reader.next(edge_count) )
+    throw std::runtime_error( "missing vertex and edge counts" );
+  AbstractUGraph::checkedVertexCount( vertex_count );
+  progress.edge_count = edge_count;
+
+  vector<Run> runs;
+  vector<Arc> arcs;
+  arcs.reserve( std::max<size_t>( 2, _memory_budget / sizeof(Arc) ) );
+
+  auto spill = [&]() {
+    std::sort( arcs.begin(), arcs.end() );
+    Run run = { createTempFile(_temp_directory), arcs.size() };
+    BufferedWriter writer( run.file.get(), 0 );
+    writer.write( arcs.data(), arcs.size() * sizeof(Arc) );
+    writer.flush();
+    runs.push_back( std::move(run) );
+    arcs.clear();
+    progress.runs = runs.size();
+  };
+
+  for ( uint64_t i = 0; i < edge_count; ++i ) {
+    uint64_t endpoints[2];
+    for ( auto& endpoint : endpoints ) {
+      try {
+        if ( !reader.next(endpoint) )
+          throw std::runtime_error( "input ended after " + to_string(i) + " of " + to_string(edge_count) + " edges" );
+      } catch ( std::runtime_error const& e ) {
+        throw std::runtime_error( "edge " + to_string(i) + ": " + e.what() );
+      }
+      if ( endpoint >= vertex_count )
+        throw std::runtime_error( "edge " + to_string(i) + ": vertex ID " + to_string(endpoint) +
+            " is out of range for a graph with " + to_string(vertex_count) + " vertices" );
+    }
+
+    if ( arcs.size() + 2 > arcs.capacity() )
+      spill();
+    arcs.emplace_back( endpoints[0], endpoints[1] );
+    arcs.emplace_back( endpoints[1], endpoints[0] );
+
+    progress.edges_read = i + 1;
+    if ( progress.edges_read % PROGRESS_INTERVAL == 0 )
+      report( Progress::Reading );
+  }
+  report( Progress::Reading );
+
+  //--------- Pass 2: merge runs into the CSR file ---------//
+
+  // the merge needs the memory the arc buffer was using
+  if ( !runs.empty() ) {
+    if ( !arcs.empty() )
+      spill();
+    vector<Arc>().swap( arcs );
+  } else {
+    std::sort( arcs.begin(), arcs.end() );
+  }
+
+  size_t const max_fan_in = std::max<size_t>( 2, _memory_budget / MIN_RUN_BUFFER_BYTES );
+
+  // combine runs until a single merge can read all of them
+  while ( runs.size() > max_fan_in ) {
+    RunMerger merger( runs.begin(), runs.begin() + max_fan_in, _memory_budget );
+    Run merged = { createTempFile(_temp_directory), merger.total() };
+    BufferedWriter writer( merged.file.get(), 0 );
+
+    progress.arcs_merged = 0;
+    progress.arcs_total = merger.total();
+    Arc arc;
+    while ( merger.next(arc) ) {
+      writer.writeValue( arc );
+      if ( ++progress.arcs_merged % PROGRESS_INTERVAL == 0 )
+        report( Progress::Merging );
+    }
+    writer.flush();
+
+    runs.erase( runs.begin(), runs.begin() + max_fan_in );
+    runs.push_back( std::move(merged) );
+    progress.runs = runs.size();
+  }
+
+  int const out_fd = ::open( output_filename.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644 );
+  if ( out_fd < 0 )
+    throwSystemError( "Can't create " + output_filename );
+  FileDescriptor const output( out_fd );
+
+  BufferedWriter offsets( out_fd, BinaryGraphFormat::offsetsPosition() );
+  BufferedWriter neighbors( out_fd, BinaryGraphFormat::neighborsPosition(vertex_count) );
+
+  // offsets[u] is the number of arcs whose source is below u; it is written
+  // for every vertex up to the source of each arc as the arcs stream past
+  uint64_t next_vertex = 0;
+  uint64_t written = 0;
+  auto emit = [&]( Arc const& arc ) {
+    for ( ; next_vertex <= arc.first; ++next_vertex )
+      offsets.writeValue( written );
+    neighbors.writeValue( arc.second );
+    ++written;
+    progress.arcs_merged = written;
+    if ( written % PROGRESS_INTERVAL == 0 )
+      report( Progress::Merging );
+  };
+
+  progress.arcs_merged = 0;
+  progress.arcs_total = 2 * edge_count;
+  if ( runs.empty() ) {
+    for ( auto const& arc : arcs )
+      emit( arc );
+  } else {
+    RunMerger merger( runs.begin(), runs.end(), _memory_budget );
+    Arc arc;
+    while ( merger.next(arc) )
+      emit( arc );
+  }
+  for ( ; next_vertex <= vertex_count; ++next_vertex )
+    offsets.writeValue( written );
+
+  offsets.flush();
+  neighbors.flush();
+
+  BinaryGraphFormat::Header const header =
+    BinaryGraphFormat::makeHeader( vertex_count, edge_count, written, BinaryGraphFormat::SORTED_ADJACENCY );
+  BufferedWriter header_writer( out_fd, 0 );
+  header_writer.writeValue( header );
+  header_writer.flush();
+
+  report( Progress::Done );
+}
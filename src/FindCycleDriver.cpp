@@ -8,12 +8,15 @@
 #include "AbstractUGraph.hpp"
 #include "AMUGraph.hpp"
 #include "ALUGraph.hpp"
+#include "BinaryGraphFormat.hpp"
+#include "CSRUGraph.hpp"
+#include "EdgeListLoader.hpp"
+#include "GraphWriter.hpp"
 #include "GraphInfo.hpp"
 
 #include <boost/program_options.hpp>
 
 #include <iostream>
-#include <fstream> // ifstream
 #include <string> // string
 #include <vector>
 #include <array>
@@ -21,7 +24,6 @@
 #include <experimental/optional>
 
 using std::string;
-using std::ifstream;
 using std::cin;
 using std::cout;
 using std::endl;
@@ -35,7 +37,7 @@ void parseProgramOptions( int argc, char **argv, bpo::options_description& desc,
 {
   desc.add_options()
     ("help,h"      , "Show this message")
-    ("input-file,i", "Input file to read")
+    ("input-file,i", "Input file to read, as an edge list or a binary graph")
     ;
 
   // the positional argument is input-file
@@ -49,14 +51,21 @@ void parseProgramOptions( int argc, char **argv, bpo::options_description& desc,
   bpo::notify( vm );
 }
 
-ALUGraph parseGraph( bpo::variables_map& vm )
+CSRUGraph parseGraph( bpo::variables_map& vm )
 {
-  if ( vm.count("input-file") ) {
-    string filename = vm["input-file"].as<string>();
-    ifstream file( filename );
-    return ALUGraph( file );
-  } else {
-    return ALUGraph( cin );
+  try {
+    if ( vm.count("input-file") ) {
+      string filename = vm["input-file"].as<string>();
+      // binary graphs are mapped and used in place; text is parsed in parallel
+      if ( BinaryGraphFormat::isBinaryGraphFile(filename) )
+        return BinaryGraphFormat::map( filename );
+      return EdgeListLoader( filename ).build<CSRUGraph>();
+    } else {
+      return CSRUGraph( cin );
+    }
+  } catch ( std::exception const& e ) {
+    std::cerr << "*** " << e.what() << endl;
+    std::exit( EXIT_FAILURE );
   }
 }
 
@@ -72,10 +81,10 @@ int main( int argc, char **argv )
     std::exit( EXIT_SUCCESS );
   }
 
-  ALUGraph ug = parseGraph( vm );
+  CSRUGraph ug = parseGraph( vm );
 
   cout << "The graph is this: " << endl;
-  cout << ug.toString();
+  GraphWriter( cout ).writeAdjacencyLists( ug );
 
   auto maybeCycle = GraphInfo::findCycle( ug );
   typedef std::vector<VertexID> Path;
@@ -0,0 +1,111 @@
+/** \file GirthDriver.cpp
+ * Driver for findShortestCycle
+ *
+ * \author Brian Heim
+ * \date   2026-10-17
+ */
+
+#include "AbstractUGraph.hpp"
+#include "AMUGraph.hpp"
+#include "ALUGraph.hpp"
+#include "BinaryGraphFormat.hpp"
+#include "CSRUGraph.hpp"
+#include "EdgeListLoader.hpp"
+#include "GraphWriter.hpp"
+#include "GraphInfo.hpp"
+#include "ThreadPool.hpp"
+
+#include <boost/program_options.hpp>
+
+#include <iostream>
+#include <string> // string
+#include <vector>
+#include <array>
+#include <numeric>
+#include <experimental/optional>
+
+using std::string;
+using std::cin;
+using std::cout;
+using std::endl;
+using std::array;
+using std::vector;
+
+using VertexID = AbstractUGraph::VertexID;
+namespace bpo = boost::program_options;
+
+void parseProgramOptions( int argc, char **argv, bpo::options_description& desc, bpo::variables_map& vm )
+{
+  desc.add_options()
+    ("help,h"      , "Show this message")
+    ("input-file,i", "Input file to read, as an edge list or a binary graph")
+    ("threads,t"   , bpo::value<size_t>()->default_value(0), "Worker threads; 0 means one per hardware thread")
+    ("max-length,m", bpo::value<size_t>(), "Only look for cycles of at most this many vertices")
+    ;
+
+  // the positional argument is input-file
+  bpo::positional_options_description pod;
+  pod.add( "input-file", 1 );
+
+  bpo::store(
+      bpo::command_line_parser(argc, argv).options(desc).positional(pod).run(),
+      vm
+      );
+  bpo::notify( vm );
+}
+
+CSRUGraph parseGraph( bpo::variables_map& vm )
+{
+  try {
+    if ( vm.count("input-file") ) {
+      string filename = vm["input-file"].as<string>();
+      // binary graphs are mapped and used in place; text is parsed in parallel
+      if ( BinaryGraphFormat::isBinaryGraphFile(filename) )
+        return BinaryGraphFormat::map( filename );
+      return EdgeListLoader( filename ).build<CSRUGraph>();
+    } else {
+      return CSRUGraph( cin );
+    }
+  } catch ( std::exception const& e ) {
+    std::cerr << "*** " << e.what() << endl;
+    std::exit( EXIT_FAILURE );
+  }
+}
+
+int main( int argc, char **argv )
+{
+  bpo::options_description desc( "Allowed options" );
+  bpo::variables_map vm;
+  parseProgramOptions( argc, argv, desc, vm );
+
+  // if help is requested, just print help and exit
+  if ( vm.count("help") ) {
+    cout << desc << endl;
+    std::exit( EXIT_SUCCESS );
+  }
+
+  CSRUGraph ug = parseGraph( vm );
+
+  cout << "The graph is this: " << endl;
+  GraphWriter( cout ).writeAdjacencyLists( ug );
+
+  ThreadPool pool( vm["threads"].as<size_t>() );
+  auto maybeCycle = vm.count("max-length")
+    ? GraphInfo::findShortestCycle( ug, pool, vm["max-length"].as<size_t>() )
+    : GraphInfo::findShortestCycle( ug, pool );
+  typedef std::vector<VertexID> Path;
+
+  if ( maybeCycle ) {
+    cout << "The girth is " << maybeCycle->size() << ". Here is a shortest cycle: " << endl;
+    for ( Path::const_iterator it = maybeCycle->cbegin(); it != maybeCycle->cend(); ++it )
+      cout << "\t" << *it;
+    cout << endl;
+  } else if ( vm.count("max-length") ) {
+    cout << "No cycle of at most " << vm["max-length"].as<size_t>() << " vertices." << endl;
+  } else {
+    cout << "No cycle, so the girth is infinite." << endl;
+  }
+
+  std::exit( EXIT_SUCCESS );
+}
+
@@ -0,0 +1,822 @@
+/** \file GraphBenchDriver.cpp
+ * Benchmark suites comparing graph representations and algorithms.
+ *
+ * \author Brian Heim
+ * \date   2026-10-17
+ */
+
+#include "AbstractUGraph.hpp"
+#include "ALUGraph.hpp"
+#include "AMUGraph.hpp"
+#include "Biconnectivity.hpp"
+#include "BinaryGraphFormat.hpp"
+#include "BreadthFirstSearch.hpp"
+#include "CSRUGraph.hpp"
+#include "CompressedUGraph.hpp"
+#include "ConnectedComponents.hpp"
+#include "CoreDecomposition.hpp"
+#include "DepthFirstSearch.hpp"
+#include "DepthFirstTraversal.hpp"
+#include "Diameter.hpp"
+#include "DirectionOptimizingBFS.hpp"
+#include "EccentricityBounds.hpp"
+#include "EdgeListLoader.hpp"
+#include "GraphGenerator.hpp"
+#include "IncrementalConnectivity.hpp"
+#include "MultiSourceBFS.hpp"
+#include "ParallelBFS.hpp"
+#include "ParallelConnectedComponents.hpp"
+#include "ParallelCoreDecomposition.hpp"
+#include "RandomGraphs.hpp"
+#include "ThreadPool.hpp"
+#include "TriangleCounting.hpp"
+#include "VertexOrdering.hpp"
+
+#include <boost/program_options.hpp>
+
+#include <algorithm> // max_element, min, sort, unique
+#include <chrono>
+#include <cmath> // pow
+#include <cstdint> // uint64_t
+#include <functional> // function
+#include <iomanip> // setw, setprecision
+#include <iostream>
+#include <limits> // numeric_limits
+#include <memory> // unique_ptr
+#include <random> // mt19937_64
+#include <sstream> // ostringstream
+#include <stdexcept> // logic_error
+#include <string> // string
+#include <vector>
+
+using std::string;
+using std::vector;
+using std::cin;
+using std::cout;
+using std::endl;
+
+using VertexID = AbstractUGraph::VertexID;
+using size_type = AbstractUGraph::size_type;
+namespace bpo = boost::program_options;
+
+/// What every suite gets to work with
+struct BenchContext
+{
+  CSRUGraph const& graph;
+  vector<VertexID> sources; ///< start vertices for traversals
+  size_t repeat;            ///< runs per measurement; the best is reported
+  size_t threads;           ///< worker threads; 0 means one per hardware thread
+};
+
+/// A named group of measurements
+struct Suite
+{
+  string name;
+  string description;
+  std::function<void(BenchContext const&)> run;
+};
+
+/// Best wall-clock time of `repeat` calls to `fn`, in seconds
+template<class F>
+double bestSeconds( size_t const repeat, F&& fn )
+{
+  double best = std::numeric_limits<double>::infinity();
+  for ( size_t i = 0; i < std::max<size_t>( 1, repeat ); ++i ) {
+    auto const start = std::chrono::steady_clock::now();
+    fn();
+    std::chrono::duration<double> const elapsed = std::chrono::steady_clock::now() - start;
+    best = std::min( best, elapsed.count() );
+  }
+  return best;
+}
+
+/// Prints one `name: value` result line
+void report( string const& name, string const& value )
+{
+  cout << "  " << std::left << std::setw(32) << name + ":" << value << endl;
+}
+
+/// `value` with `precision` decimals, followed by `unit`
+string formatFixed( double const value, int const precision, string const& unit )
+{
+  std::ostringstream ss;
+  ss << std::fixed << std::setprecision(precision) << value << unit;
+  return ss.str();
+}
+
+string formatMilliseconds( double const seconds ) { return formatFixed( seconds * 1e3, 3, " ms" ); }
+
+string formatRatio( double const ratio ) { return formatFixed( ratio, 2, "x" ); }
+
+/// Vertices visited by a BFS from each source, summed
+template<class G>
+size_type bfsFromSources( G const& graph, vector<VertexID> const& sources )
+{
+  BreadthFirstSearch<G> search( graph );
+  size_type visited = 0;
+  for ( auto const source : sources ) {
+    search.search( source );
+    visited += search.count();
+  }
+  return visited;
+}
+
+/// Vertices visited by a DFS from each source, summed
+template<class G>
+size_type dfsFromSources( G const& graph, vector<VertexID> const& sources )
+{
+  DepthFirstSearch<G> search( graph );
+  size_type visited = 0;
+  for ( auto const source : sources ) {
+    search.search( source );
+    visited += search.count();
+  }
+  return visited;
+}
+
+/// Sum of every neighbor of every vertex, so that the scan can't be skipped
+template<class G>
+std::uint64_t scanNeighbors( G const& graph )
+{
+  std::uint64_t sum = 0;
+  for ( VertexID v = 0; v < graph.v(); ++v )
+    for ( auto const w : graph.neighbors(v) )
+      sum += w;
+  return sum;
+}
+
+/// `count` start vertices drawn with a fixed seed, so runs are comparable
+vector<VertexID> pickSources( CSRUGraph const& graph, size_t const count )
+{
+  vector<VertexID> sources;
+  if ( graph.v() == 0 )
+    return sources;
+
+  std::mt19937_64 engine;
+  std::uniform_int_distribution<size_type> pick( 0, graph.v() - 1 );
+  for ( size_t i = 0; i < count; ++i )
+    sources.push_back( pick(engine) );
+  return sources;
+}
+
+/// Compressed adjacency lists against CSR: size, build time and traversal cost
+void runCompressionSuite( BenchContext const& context )
+{
+  CSRUGraph const& graph = context.graph;
+
+  CompressedUGraph compressed = CompressedUGraph( graph, context.threads );
+  double const build_time = bestSeconds( context.repeat, [&]() {
+      compressed = CompressedUGraph( graph, context.threads );
+  } );
+
+  // a CSR graph with the same, sorted, adjacency order makes the traversal
+  // comparison fair
+  CSRUGraph const sorted( compressed );
+
+  size_type const csr_bytes = (graph.v() + 1) * sizeof(size_type) + graph.neighborCount() * sizeof(VertexID);
+  size_type const neighbor_bytes = compressed.byteSize() - (graph.v() + 1) * sizeof(size_type);
+  report( "CSR bytes", std::to_string(csr_bytes) );
+  report( "compressed bytes", std::to_string(compressed.byteSize()) );
+  report( "compression ratio", formatRatio( double(csr_bytes) / compressed.byteSize() ) );
+  report( "bits per neighbor", formatFixed( graph.neighborCount() ? 8.0 * neighbor_bytes / graph.neighborCount() : 0.0, 2, "" ) );
+  report( "encode time", formatMilliseconds(build_time) );
+
+  size_type csr_visited = 0, compressed_visited = 0;
+  double const csr_bfs = bestSeconds( context.repeat, [&]() {
+      csr_visited = bfsFromSources( sorted, context.sources );
+  } );
+  double const compressed_bfs = bestSeconds( context.repeat, [&]() {
+      compressed_visited = bfsFromSources( compressed, context.sources );
+  } );
+  if ( csr_visited != compressed_visited )
+    throw std::logic_error( "BFS visited different vertex counts on the two representations" );
+
+  report( "BFS, CSR", formatMilliseconds(csr_bfs) );
+  report( "BFS, compressed", formatMilliseconds(compressed_bfs) );
+  report( "BFS slowdown", formatRatio( compressed_bfs / csr_bfs ) );
+
+  std::uint64_t csr_sum = 0, compressed_sum = 0;
+  double const csr_scan = bestSeconds( context.repeat, [&]() { csr_sum = scanNeighbors( sorted ); } );
+  double const compressed_scan = bestSeconds( context.repeat, [&]() { compressed_sum = scanNeighbors( compressed ); } );
+  if ( csr_sum != compressed_sum )
+    throw std::logic_error( "neighbor scans differ between the two representations" );
+
+  report( "full scan, CSR", formatMilliseconds(csr_scan) );
+  report( "full scan, compressed", formatMilliseconds(compressed_scan) );
+  report( "full scan slowdown", formatRatio( compressed_scan / csr_scan ) );
+}
+
+/// Traversal time after relabeling the graph by each vertex ordering
+void runReorderSuite( BenchContext const& context )
+{
+  CSRUGraph const& graph = context.graph;
+
+  struct Ordering
+  {
+    string name;
+    std::function<Permutation()> compute;
+  };
+  vector<Ordering> const orderings = {
+    { "original", [&]() { return Permutation::identity( graph.v() ); } },
+    { "degree", [&]() { return VertexOrdering::degreeOrder( graph ); } },
+    { "bfs", [&]() { return VertexOrdering::breadthFirstOrder( graph ); } },
+    { "rcm", [&]() { return VertexOrdering::reverseCuthillMcKee( graph ); } },
+    { "community", [&]() { return VertexOrdering::communityOrder( graph ); } },
+  };
+
+  double original_bfs = 0, original_dfs = 0;
+  size_type original_visited = 0;
+  for ( auto const& ordering : orderings ) {
+    Permutation permutation;
+    double const order_time = bestSeconds( 1, [&]() { permutation = ordering.compute(); } );
+
+    // relabeling sorts every list, so even "original" is compared on equal terms
+    CSRUGraph const relabeled = VertexOrdering::relabel( graph, permutation );
+    vector<VertexID> sources;
+    for ( auto const source : context.sources )
+      sources.push_back( permutation.toNew(source) );
+
+    size_type bfs_visited = 0, dfs_visited = 0;
+    double const bfs = bestSeconds( context.repeat, [&]() { bfs_visited = bfsFromSources( relabeled, sources ); } );
+    double const dfs = bestSeconds( context.repeat, [&]() { dfs_visited = dfsFromSources( relabeled, sources ); } );
+    size_type const visited = bfs_visited + dfs_visited;
+
+    if ( ordering.name == "original" ) {
+      original_bfs = bfs;
+      original_dfs = dfs;
+      original_visited = visited;
+    } else if ( visited != original_visited ) {
+      throw std::logic_error( "traversals after the " + ordering.name + " ordering visited different vertex counts" );
+    }
+
+    report( ordering.name + " ordering time", formatMilliseconds(order_time) );
+    report( ordering.name + " BFS", formatMilliseconds(bfs) + " (" + formatRatio(original_bfs / bfs) + " speedup)" );
+    report( ordering.name + " DFS", formatMilliseconds(dfs) + " (" + formatRatio(original_dfs / dfs) + " speedup)" );
+  }
+}
+
+/// Classic top-down BFS against direction-optimizing BFS
+void runBFSSuite( BenchContext const& context )
+{
+  CSRUGraph const& graph = context.graph;
+  typedef DirectionOptimizingBFS<CSRUGraph> DOBFS;
+
+  size_type classic_visited = 0, optimized_visited = 0, classic_edges = 0, optimized_edges = 0;
+  double const classic = bestSeconds( context.repeat, [&]() {
+      classic_visited = bfsFromSources( graph, context.sources );
+  } );
+  double const optimized = bestSeconds( context.repeat, [&]() {
+      optimized_visited = 0;
+      optimized_edges = 0;
+      for ( auto const source : context.sources ) {
+        DOBFS const bfs( graph, source );
+        optimized_visited += bfs.count();
+        for ( auto const& level : bfs.levels() )
+          optimized_edges += level.edges_examined;
+      }
+  } );
+  if ( classic_visited != optimized_visited )
+    throw std::logic_error( "direction-optimizing BFS visited a different number of vertices" );
+
+  // the classic search reads the whole list of every vertex it reaches
+  for ( auto const source : context.sources ) {
+    DOBFS const bfs( graph, source );
+    for ( auto const& level : bfs.levels() )
+      classic_edges += level.frontier_edges;
+  }
+
+  report( "top-down BFS", formatMilliseconds(classic) );
+  report( "direction-optimizing BFS", formatMilliseconds(optimized) );
+  report( "speedup", formatRatio( classic / optimized ) );
+  report( "edges examined, top-down", std::to_string(classic_edges) );
+  report( "edges examined, optimizing", std::to_string(optimized_edges) );
+
+  if ( context.sources.empty() )
+    return;
+  DOBFS const bfs( graph, context.sources[0] );
+  cout << "  levels from vertex " << context.sources[0] << ":\n";
+  for ( auto const& level : bfs.levels() )
+    cout << "    depth " << level.depth << ": "
+         << (level.direction == DOBFS::Direction::TopDown ? "top-down " : "bottom-up")
+         << "  frontier " << level.frontier_size << ", examined " << level.edges_examined << " of "
+         << level.frontier_edges << " frontier edges\n";
+}
+
+/// 1, 2, 4, ... threads up to the context's thread count
+vector<size_t> threadCounts( BenchContext const& context )
+{
+  size_t const max_threads = context.threads ? context.threads : ThreadPool::defaultThreadCount();
+  vector<size_t> counts;
+  for ( size_t threads = 1; threads < max_threads; threads *= 2 )
+    counts.push_back( threads );
+  counts.push_back( max_threads );
+  return counts;
+}
+
+/// Level-synchronous parallel BFS from 1 to N threads
+void runParallelBFSSuite( BenchContext const& context )
+{
+  CSRUGraph const& graph = context.graph;
+
+  size_type classic_visited = 0;
+  double const classic = bestSeconds( context.repeat, [&]() {
+      classic_visited = bfsFromSources( graph, context.sources );
+  } );
+  report( "BreadthFirstSearch", formatMilliseconds(classic) );
+
+  double one_thread = 0;
+  for ( auto const threads : threadCounts(context) ) {
+    ThreadPool pool( threads );
+    size_type visited = 0;
+    double const parallel = bestSeconds( context.repeat, [&]() {
+        visited = 0;
+        for ( auto const source : context.sources )
+          visited += ParallelBFS<CSRUGraph>( graph, source, pool ).count();
+    } );
+    if ( visited != classic_visited )
+      throw std::logic_error( "parallel BFS visited a different number of vertices" );
+
+    if ( threads == 1 )
+      one_thread = parallel;
+    report( "ParallelBFS, threads=" + std::to_string(threads),
+            formatMilliseconds(parallel) + " (" + formatRatio(one_thread / parallel) + " of 1 thread)" );
+  }
+}
+
+/// One BFS per source against a bit-parallel multi-source BFS
+void runMultiSourceBFSSuite( BenchContext const& context )
+{
+  CSRUGraph const& graph = context.graph;
+  size_t const source_count = context.sources.size();
+
+  vector<size_t> single_counts( source_count );
+  double const single = bestSeconds( context.repeat, [&]() {
+      BreadthFirstSearch<CSRUGraph> bfs( graph );
+      for ( size_t i = 0; i < source_count; ++i ) {
+        bfs.search( context.sources[i] );
+        single_counts[i] = bfs.count();
+      }
+  } );
+
+  vector<size_t> batched_counts( source_count );
+  double const batched = bestSeconds( context.repeat, [&]() {
+      MultiSourceBFS<CSRUGraph> const bfs( graph, context.sources );
+      for ( size_t i = 0; i < source_count; ++i )
+        batched_counts[i] = bfs.count(i);
+  } );
+  if ( single_counts != batched_counts )
+    throw std::logic_error( "multi-source BFS counts differ from BreadthFirstSearch" );
+
+  report( "sources", std::to_string(source_count) );
+  report( "one BFS per source", formatMilliseconds(single) );
+  report( "multi-source BFS", formatMilliseconds(batched) );
+  report( "speedup", formatRatio( single / batched ) );
+}
+
+/// Sequential BFS components against parallel union-find from 1 to N threads
+void runComponentsSuite( BenchContext const& context )
+{
+  CSRUGraph const& graph = context.graph;
+
+  vector<VertexID> classic_ids( graph.v() );
+  size_type classic_count = 0;
+  double const classic = bestSeconds( context.repeat, [&]() {
+      ConnectedComponents<CSRUGraph> const cc( graph, false, cout );
+      classic_count = cc.count();
+      for ( VertexID v = 0; v < graph.v(); ++v )
+        classic_ids[v] = cc.id( v );
+  } );
+  report( "components", std::to_string(classic_count) );
+  report( "ConnectedComponents", formatMilliseconds(classic) );
+
+  for ( auto const threads : threadCounts(context) ) {
+    ThreadPool pool( threads );
+    vector<VertexID> ids( graph.v() );
+    size_type count = 0;
+    double const parallel = bestSeconds( context.repeat, [&]() {
+        ParallelConnectedComponents<CSRUGraph> const cc( graph, pool );
+        count = cc.count();
+        for ( VertexID v = 0; v < graph.v(); ++v )
+          ids[v] = cc.id( v );
+    } );
+    if ( count != classic_count || ids != classic_ids )
+      throw std::logic_error( "parallel components differ from ConnectedComponents" );
+
+    report( "union-find, threads=" + std::to_string(threads),
+            formatMilliseconds(parallel) + " (" + formatRatio(classic / parallel) + " of sequential)" );
+  }
+}
+
+/// Union-find fed one edge at a time against rebuilding the components
+void runIncrementalSuite( BenchContext const& context )
+{
+  CSRUGraph const& graph = context.graph;
+  size_t const query_count = 1 << 20;
+
+  size_type rebuilt_count = 0;
+  double const rebuild = bestSeconds( context.repeat, [&]() {
+      rebuilt_count = ConnectedComponents<CSRUGraph>( graph, false, cout ).count();
+  } );
+
+  IncrementalConnectivity connectivity;
+  double const insert = bestSeconds( context.repeat, [&]() {
+      connectivity = IncrementalConnectivity( graph.v() );
+      connectivity.addEdgesOf( graph );
+  } );
+  if ( connectivity.count() != rebuilt_count )
+    throw std::logic_error( "incremental connectivity counts differ from ConnectedComponents" );
+
+  vector<VertexID> const ends = pickSources( graph, 2 * query_count );
+  size_t connected = 0;
+  double const query = bestSeconds( context.repeat, [&]() {
+      connected = 0;
+      for ( size_t i = 0; i + 1 < ends.size(); i += 2 )
+        connected += connectivity.connected( ends[i], ends[i+1] );
+  } );
+
+  report( "components", std::to_string(rebuilt_count) );
+  report( "rebuild ConnectedComponents", formatMilliseconds(rebuild) );
+  report( "add every edge", formatMilliseconds(insert) + " ("
+          + formatFixed( insert * 1e9 / std::max<size_type>( graph.e(), 1 ), 1, " ns/edge" ) + ")" );
+  report( "connected()", formatFixed( query * 1e9 / std::max<size_t>( ends.size() / 2, 1 ), 1, " ns/query" )
+          + ", " + std::to_string(connected) + " of " + std::to_string(ends.size() / 2) + " pairs connected" );
+}
+
+/// Explicit-stack DFS and the biconnectivity built on it
+void runBiconnectedSuite( BenchContext const& context )
+{
+  CSRUGraph const& graph = context.graph;
+
+  size_type trees = 0;
+  double const traversal = bestSeconds( context.repeat, [&]() {
+      trees = DepthFirstTraversal<CSRUGraph>( graph ).rootCount();
+  } );
+
+  size_type components = 0, bridges = 0, articulation_points = 0;
+  double const biconnectivity = bestSeconds( context.repeat, [&]() {
+      Biconnectivity<CSRUGraph> const bc( graph );
+      components = bc.componentCount();
+      bridges = bc.bridges().size();
+      articulation_points = bc.articulationPoints().size();
+  } );
+
+  report( "DFS trees", std::to_string(trees) );
+  report( "DepthFirstTraversal", formatMilliseconds(traversal) + " ("
+          + formatFixed( traversal * 1e9 / std::max<size_type>( 2 * graph.e(), 1 ), 1, " ns/arc" ) + ")" );
+  report( "Biconnectivity", formatMilliseconds(biconnectivity) );
+  report( "biconnected components", std::to_string(components) );
+  report( "bridges", std::to_string(bridges) );
+  report( "articulation points", std::to_string(articulation_points) );
+}
+
+/// Exact diameters and eccentricity bounds, with the searches they took
+void runDiameterSuite( BenchContext const& context )
+{
+  CSRUGraph const& graph = context.graph;
+
+  for ( auto const threads : threadCounts(context) ) {
+    ThreadPool pool( threads );
+    size_type diameter = 0, searches = 0;
+    double const exact = bestSeconds( context.repeat, [&]() {
+        Diameter<CSRUGraph> const d( graph, pool );
+        diameter = d.diameter();
+        searches = d.searchCount();
+    } );
+
+    size_type exact_count = 0, bound_searches = 0;
+    double const bounds = bestSeconds( context.repeat, [&]() {
+        EccentricityBounds<CSRUGraph> const eb( graph, pool );
+        exact_count = 0;
+        for ( VertexID v = 0; v < graph.v(); ++v )
+          exact_count += eb.exact( v );
+        bound_searches = eb.searchCount();
+    } );
+
+    std::string const suffix = ", threads=" + std::to_string(threads);
+    report( "diameter" + suffix, std::to_string(diameter) + " (" + std::to_string(searches)
+            + " searches of " + std::to_string(graph.v()) + " naively)" );
+    report( "Diameter" + suffix, formatMilliseconds(exact) );
+    report( "EccentricityBounds" + suffix, formatMilliseconds(bounds) + " (" + std::to_string(bound_searches)
+            + " searches, " + std::to_string(exact_count) + " vertices exact)" );
+  }
+}
+
+/// Sorted-list triangle counting from 1 to N threads, against bitset rows
+/// when the graph is small enough for an adjacency matrix
+void runTrianglesSuite( BenchContext const& context )
+{
+  CSRUGraph const& graph = context.graph;
+
+  // an adjacency matrix costs V^2 bits, so only small graphs get one
+  static constexpr size_type MATRIX_LIMIT = 32768;
+  std::unique_ptr<AMUGraph> matrix;
+  if ( graph.v() <= MATRIX_LIMIT ) {
+    matrix.reset( new AMUGraph( graph.v() ) );
+    for ( VertexID v = 0; v < graph.v(); ++v )
+      for ( auto const w : graph.neighbors(v) )
+        if ( v <= w )
+          matrix->addEdge( v, w );
+  }
+
+  for ( auto const threads : threadCounts(context) ) {
+    ThreadPool pool( threads );
+    size_type triangles = 0;
+    double average_clustering = 0;
+    double const lists = bestSeconds( context.repeat, [&]() {
+        TriangleCounting<CSRUGraph> const tc( graph, pool );
+        triangles = tc.count();
+        average_clustering = tc.averageClustering();
+    } );
+
+    std::string const suffix = ", threads=" + std::to_string(threads);
+    if ( threads == 1 ) {
+      report( "triangles", std::to_string(triangles) );
+      report( "average clustering", formatFixed( average_clustering, 4, "" ) );
+    }
+    report( "sorted lists" + suffix, formatMilliseconds(lists) + " ("
+            + formatFixed( lists * 1e9 / std::max<size_type>( graph.e(), 1 ), 1, " ns/edge" ) + ")" );
+
+    if ( !matrix ) {
+      report( "bitset rows" + suffix, "skipped, more than " + std::to_string(MATRIX_LIMIT) + " vertices" );
+      continue;
+    }
+    size_type matrix_triangles = 0;
+    double const bitsets = bestSeconds( context.repeat, [&]() {
+        matrix_triangles = TriangleCounting<AMUGraph>( *matrix, pool ).count();
+    } );
+    if ( matrix_triangles != triangles )
+      throw std::logic_error( "bitset triangle count differs from sorted lists" );
+    report( "bitset rows" + suffix, formatMilliseconds(bitsets) + " (" + formatRatio(lists / bitsets) + " of sorted lists)" );
+  }
+}
+
+/// Simple graph from `edge_count` draws of two ends, each end picked with
+/// weight (i+1)^-1/(gamma-1) for vertex i as in the Chung-Lu model, so
+/// degrees follow a power law of exponent `gamma`. Repeated draws and
+/// self-loops are dropped. Drawn with a fixed seed.
+CSRUGraph skewedGraph( size_type const vertex_count, size_type const edge_count, double const gamma = 2.1 )
+{
+  vector<double> weights( vertex_count );
+  for ( size_type i = 0; i < vertex_count; ++i )
+    weights[i] = std::pow( double(i + 1), -1 / (gamma - 1) );
+  std::discrete_distribution<size_type> pick( weights.begin(), weights.end() );
+
+  std::mt19937_64 engine;
+  AbstractUGraph::EdgeList edges;
+  edges.reserve( edge_count );
+  for ( size_type i = 0; i < edge_count; ++i ) {
+    VertexID const v = pick( engine ), w = pick( engine );
+    if ( v != w )
+      edges.push_back( AbstractUGraph::Edge( std::min(v, w), std::max(v, w) ) );
+  }
+  std::sort( edges.begin(), edges.end() );
+  edges.erase( std::unique( edges.begin(), edges.end() ), edges.end() );
+  return CSRUGraph( vertex_count, edges );
+}
+
+/// Sequential bucket peeling against parallel level-synchronous peeling,
+/// on the graph and on a power-law graph of the same size
+void runCoresSuite( BenchContext const& context )
+{
+  CSRUGraph const skewed = skewedGraph( context.graph.v(), context.graph.e() );
+  for ( auto const graph : { &context.graph, &skewed } ) {
+    if ( graph == &skewed )
+      report( "power-law graph", std::to_string(graph->v()) + " vertices, " + std::to_string(graph->e()) + " edges" );
+
+    vector<VertexID> cores( graph->v() );
+    VertexID degeneracy = 0;
+    double const sequential = bestSeconds( context.repeat, [&]() {
+        CoreDecomposition<CSRUGraph> const cd( *graph );
+        degeneracy = cd.degeneracy();
+        for ( VertexID v = 0; v < graph->v(); ++v )
+          cores[v] = cd.core( v );
+    } );
+    size_type max_degree = 0;
+    for ( VertexID v = 0; v < graph->v(); ++v )
+      max_degree = std::max( max_degree, graph->degree(v) );
+    report( "max degree", std::to_string(max_degree) );
+    report( "degeneracy", std::to_string(degeneracy) );
+    report( "CoreDecomposition", formatMilliseconds(sequential) + " ("
+            + formatFixed( sequential * 1e9 / std::max<size_type>( 2 * graph->e(), 1 ), 1, " ns/arc" ) + ")" );
+
+    for ( auto const threads : threadCounts(context) ) {
+      ThreadPool pool( threads );
+      vector<VertexID> parallel_cores( graph->v() );
+      double const parallel = bestSeconds( context.repeat, [&]() {
+          ParallelCoreDecomposition<CSRUGraph> const pcd( *graph, pool );
+          for ( VertexID v = 0; v < graph->v(); ++v )
+            parallel_cores[v] = pcd.core( v );
+      } );
+      if ( parallel_cores != cores )
+        throw std::logic_error( "parallel core numbers differ from CoreDecomposition" );
+      report( "parallel peeling, threads=" + std::to_string(threads),
+              formatMilliseconds(parallel) + " (" + formatRatio(sequential / parallel) + " of sequential)" );
+    }
+  }
+}
+
+/// Erdős–Rényi generation of a graph of the same size from 1 to N threads,
+/// against adding random edges one at a time with redraws
+void runGeneratorsSuite( BenchContext const& context )
+{
+  size_type const v = context.graph.v();
+  size_type const e = context.graph.e();
+
+  // the redraws scan adjacency lists, so only small graphs get them
+  static constexpr size_type LEGACY_LIMIT = 1000000;
+  double legacy = 0;
+  if ( e <= LEGACY_LIMIT && e <= RandomGraphs::pairCount( v, false ) ) {
+    legacy = bestSeconds( context.repeat, [&]() {
+        GraphGenerator const generator( new ALUGraph( v ), e );
+    } );
+    report( "GraphGenerator", formatMilliseconds(legacy) );
+  } else {
+    report( "GraphGenerator", "skipped, more than " + std::to_string(LEGACY_LIMIT) + " edges" );
+  }
+
+  double const p = double(e) / std::max<double>( double(RandomGraphs::pairCount( v, false )), 1 );
+  vector<AbstractUGraph::EdgeList> gnm_edges, gnp_edges;
+  for ( auto const threads : threadCounts(context) ) {
+    ThreadPool pool( threads );
+    vector<AbstractUGraph::EdgeList> edges;
+    double const gnm = bestSeconds( context.repeat, [&]() {
+        edges = RandomGraphs::gnm( v, e, 1, pool );
+    } );
+    if ( gnm_edges.empty() )
+      gnm_edges = edges;
+    else if ( edges != gnm_edges )
+      throw std::logic_error( "G(n, m) gave a different graph on more threads" );
+
+    double const gnp = bestSeconds( context.repeat, [&]() {
+        edges = RandomGraphs::gnp( v, p, 1, pool );
+    } );
+    if ( gnp_edges.empty() )
+      gnp_edges = edges;
+    else if ( edges != gnp_edges )
+      throw std::logic_error( "G(n, p) gave a different graph on more threads" );
+
+    std::string const suffix = ", threads=" + std::to_string(threads);
+    report( "G(n, m)" + suffix, formatMilliseconds(gnm) + " ("
+            + formatFixed( gnm * 1e9 / std::max<size_type>( e, 1 ), 1, " ns/edge" )
+            + (legacy > 0 ? ", " + formatRatio(legacy / gnm) + " of GraphGenerator" : "") + ")" );
+    report( "G(n, p)" + suffix, formatMilliseconds(gnp) + " ("
+            + formatFixed( gnp * 1e9 / std::max<size_type>( e, 1 ), 1, " ns/edge" ) + ")" );
+  }
+}
+
+/// Per-query cost of a fresh search against a reused workspace, from
+/// vertices outside the largest component so each query reaches little
+void runWorkspaceSuite( BenchContext const& context )
+{
+  CSRUGraph const& graph = context.graph;
+  size_t const max_queries = 1000;
+
+  ConnectedComponents<CSRUGraph> const components( graph, false, cout );
+  vector<size_type> sizes( components.count(), 0 );
+  for ( VertexID v = 0; v < graph.v(); ++v )
+    ++sizes[components.id(v)];
+  size_type const largest = std::max_element( sizes.begin(), sizes.end() ) - sizes.begin();
+
+  vector<VertexID> queries;
+  for ( VertexID v = 0; v < graph.v() && queries.size() < max_queries; ++v )
+    if ( components.id(v) != largest )
+      queries.push_back( v );
+  if ( queries.empty() )
+    queries = context.sources;
+
+  size_type fresh_visited = 0;
+  double const fresh = bestSeconds( context.repeat, [&]() {
+      fresh_visited = 0;
+      for ( auto const source : queries )
+        fresh_visited += BreadthFirstSearch<CSRUGraph>( graph, source ).count();
+  } );
+
+  size_type reused_visited = 0;
+  double const reused = bestSeconds( context.repeat, [&]() {
+      reused_visited = bfsFromSources( graph, queries );
+  } );
+  if ( fresh_visited != reused_visited )
+    throw std::logic_error( "workspace BFS visited a different number of vertices" );
+
+  report( "queries", std::to_string(queries.size()) );
+  report( "vertices per query", formatFixed( double(reused_visited) / queries.size(), 1, "" ) );
+  report( "fresh search", formatFixed( fresh * 1e6 / queries.size(), 2, " us/query" ) );
+  report( "reused workspace", formatFixed( reused * 1e6 / queries.size(), 2, " us/query" ) );
+  report( "speedup", formatRatio( fresh / reused ) );
+}
+
+/// Every suite, in the order `all` runs them
+vector<Suite> const& suites()
+{
+  static vector<Suite> const all_suites = {
+    { "compression", "gap/varint adjacency lists against CSR", runCompressionSuite },
+    { "reorder", "traversal after locality-improving relabeling", runReorderSuite },
+    { "bfs", "top-down against direction-optimizing BFS", runBFSSuite },
+    { "parallel-bfs", "level-synchronous BFS scaling over threads", runParallelBFSSuite },
+    { "multi-source", "batched reachability from many sources", runMultiSourceBFSSuite },
+    { "workspace", "per-query BFS cost with a reused workspace", runWorkspaceSuite },
+    { "components", "sequential against parallel connected components", runComponentsSuite },
+    { "incremental", "union-find updated per edge against rebuilding components", runIncrementalSuite },
+    { "biconnected", "explicit-stack DFS, bridges and articulation points", runBiconnectedSuite },
+    { "diameter", "iFUB diameter and eccentricity bounds against one search per vertex", runDiameterSuite },
+    { "triangles", "sorted-list against bitset triangle counting", runTrianglesSuite },
+    { "cores", "sequential against parallel k-core peeling, also on a power-law graph", runCoresSuite },
+    { "generators", "Erdős–Rényi generation against one random edge at a time", runGeneratorsSuite },
+  };
+  return all_suites;
+}
+
+void parseProgramOptions( int argc, char **argv, bpo::options_description& desc, bpo::variables_map& vm )
+{
+  string suite_help = "Suite to run: all";
+  for ( auto const& suite : suites() )
+    suite_help += ", " + suite.name;
+
+  desc.add_options()
+    ("help,h"      , "Show this message")
+    ("input-file,i", bpo::value<string>(), "Input file to read, as an edge list or a binary graph")
+    ("suite,s"     , bpo::value<vector<string>>()->composing(), suite_help.c_str())
+    ("repeat,r"    , bpo::value<size_t>()->default_value(5), "Runs per measurement; the best is reported")
+    ("sources"     , bpo::value<size_t>()->default_value(8), "Number of random start vertices for traversals")
+    ("threads,t"   , bpo::value<size_t>()->default_value(0), "Worker threads; 0 means one per hardware thread")
+    ;
+
+  // the positional argument is input-file
+  bpo::positional_options_description pod;
+  pod.add( "input-file", 1 );
+
+  bpo::store(
+      bpo::command_line_parser(argc, argv).options(desc).positional(pod).run(),
+      vm
+      );
+  bpo::notify( vm );
+}
+
+CSRUGraph parseGraph( bpo::variables_map& vm )
+{
+  try {
+    if ( vm.count("input-file") ) {
+      string filename = vm["input-file"].as<string>();
+      // binary graphs are mapped and used in place; text is parsed in parallel
+      if ( BinaryGraphFormat::isBinaryGraphFile(filename) )
+        return BinaryGraphFormat::map( filename );
+      return EdgeListLoader( filename ).build<CSRUGraph>();
+    } else {
+      return CSRUGraph( cin );
+    }
+  } catch ( std::exception const& e ) {
+    std::cerr << "*** " << e.what() << endl;
+    std::exit( EXIT_FAILURE );
+  }
+}
+
+int main( int argc, char **argv )
+{
+  bpo::options_description desc( "Allowed options" );
+  bpo::variables_map vm;
+  parseProgramOptions( argc, argv, desc, vm );
+
+  // if help is requested, just print help and exit
+  if ( vm.count("help") ) {
+    cout << desc << endl;
+    std::exit( EXIT_SUCCESS );
+  }
+
+  vector<string> requested = vm.count("suite") ? vm["suite"].as<vector<string>>() : vector<string>{ "all" };
+  vector<Suite const*> selected;
+  for ( auto const& name : requested ) {
+    bool found = false;
+    for ( auto const& suite : suites() ) {
+      if ( name == "all" || name == suite.name ) {
+        selected.push_back( &suite );
+        found = true;
+      }
+    }
+    if ( !found ) {
+      std::cerr << "*** Unknown suite: " << name << endl;
+      std::exit( EXIT_FAILURE );
+    }
+  }
+
+  CSRUGraph const graph = parseGraph( vm );
+  BenchContext const context = {
+    graph,
+    pickSources( graph, vm["sources"].as<size_t>() ),
+    vm["repeat"].as<size_t>(),
+    vm["threads"].as<size_t>()
+  };
+
+  cout << "Graph: " << graph.v() << " vertices, " << graph.e() << " edges" << endl;
+
+  try {
+    for ( auto const suite : selected ) {
+      cout << "\n" << suite->name << " (" << suite->description << ")" << endl;
+      suite->run( context );
+    }
+  } catch ( std::exception const& e ) {
+    std::cerr << "*** " << e.what() << endl;
+    std::exit( EXIT_FAILURE );
+  }
+
+  std::exit( EXIT_SUCCESS );
+}
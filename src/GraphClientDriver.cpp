@@ -0,0 +1,117 @@
+/** \file GraphClientDriver.cpp
+ * Sends queries to a graph server and prints the answers
+ *
+ * \author Brian Heim
+ * \date   2026-10-17
+ */
+
+#include "GraphQuery.hpp"
+#include "UnixSocket.hpp"
+
+#include <boost/program_options.hpp>
+
+#include <fstream> // ifstream
+#include <iostream>
+#include <stdexcept> // invalid_argument
+#include <string> // string, getline
+#include <vector>
+
+using std::string;
+using std::cin;
+using std::cout;
+using std::endl;
+using std::vector;
+
+namespace bpo = boost::program_options;
+
+void parseProgramOptions( int argc, char **argv, bpo::options_description& desc, bpo::variables_map& vm )
+{
+  desc.add_options()
+    ("help,h"      , "Show this message")
+    ("socket,s"    , bpo::value<string>()->default_value("graph.sock"), "Path of the graph server's Unix domain socket")
+    ("query,q"     , bpo::value<vector<string>>(), "A query, such as 'path 3 7'; may be repeated")
+    ("input-file,i", bpo::value<string>(), "File of queries, one per line, instead of stdin")
+    ;
+
+  bpo::store( bpo::parse_command_line(argc, argv, desc), vm );
+  bpo::notify( vm );
+}
+
+/// Sends each query line to `server` in turn and writes the answers to
+/// `cout`, as `bfs --batch` would. Returns false if any line failed.
+template<class Lines>
+bool ask( UnixSocket const& server, Lines& next_line )
+{
+  bool ok = true;
+  string line, message;
+  size_t line_number = 0;
+  while ( next_line( line ) ) {
+    ++line_number;
+    if ( GraphQuery::isBlank( line ) )
+      continue;
+
+    GraphQuery::Query query;
+    try {
+      query = GraphQuery::parse( line );
+    } catch ( std::invalid_argument const& e ) {
+      GraphQuery::writeError( cout, line_number, e.what() );
+      ok = false;
+      continue;
+    }
+
+    server.sendMessage( GraphQuery::encode( query ) );
+    if ( !server.receiveMessage( message ) )
+      throw std::runtime_error( "The server closed the connection" );
+    GraphQuery::Answer const answer = GraphQuery::decodeAnswer( query.kind, message );
+    GraphQuery::write( cout, query, answer, line_number );
+    ok = ok && answer.error.empty();
+  }
+  cout << std::flush;
+  return ok;
+}
+
+int main( int argc, char **argv )
+{
+  bpo::options_description desc( "Allowed options" );
+  bpo::variables_map vm;
+  parseProgramOptions( argc, argv, desc, vm );
+
+  // if help is requested, just print help and exit
+  if ( vm.count("help") ) {
+    cout << desc << endl;
+    std::exit( EXIT_SUCCESS );
+  }
+
+  bool ok;
+  try {
+    UnixSocket const server = UnixSocket::connect( vm["socket"].as<string>() );
+
+    if ( vm.count("query") ) {
+      vector<string> const& queries = vm["query"].as<vector<string>>();
+      size_t next = 0;
+      auto next_line = [&]( string& line ) {
+        if ( next == queries.size() )
+          return false;
+        line = queries[next++];
+        return true;
+      };
+      ok = ask( server, next_line );
+    } else {
+      std::ifstream file;
+      if ( vm.count("input-file") ) {
+        file.open( vm["input-file"].as<string>() );
+        if ( !file )
+          throw std::runtime_error( "Can't open " + vm["input-file"].as<string>() );
+      }
+      std::istream& in = file.is_open() ? static_cast<std::istream&>(file) : cin;
+      auto next_line = [&]( string& line ) { return bool(std::getline( in, line )); };
+      ok = ask( server, next_line );
+    }
+  } catch ( std::exception const& e ) {
+    cout << std::flush;
+    std::cerr << "*** " << e.what() << endl;
+    std::exit( EXIT_FAILURE );
+  }
+
+  std::exit( ok ? EXIT_SUCCESS : EXIT_FAILURE );
+}
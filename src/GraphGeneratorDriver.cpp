@@ -5,19 +5,26 @@
  * \date   2017-07-02
  */
 
-#include "GraphGenerator.hpp"
 #include "AbstractUGraph.hpp"
-#include "ALUGraph.hpp"
 #include "AMUGraph.hpp"
+#include "BinaryGraphFormat.hpp"
+#include "CSRUGraph.hpp"
+#include "GraphWriter.hpp"
+#include "RandomGraphs.hpp"
+#include "ThreadPool.hpp"
 
 #include <boost/program_options.hpp>
 
+#include <cstdint> // uint64_t
 #include <iostream>
 #include <cstdlib>
+#include <string>
+#include <vector>
 
 using std::cout;
 using std::endl;
 using std::cin;
+using std::string;
 
 namespace bpo = boost::program_options;
 
@@ -31,7 +38,11 @@ void parse_program_options( int argc, char **argv, bpo::options_description& des
     ("matrix,m"      , "Use an adjacency matrix graph implementation. Incompatible with -l")
 
     ("vertex-count,v", bpo::value<AbstractUGraph::size_type>(), "Number of vertices in the graph")
-    ("edge-count,e"  , bpo::value<AbstractUGraph::size_type>(), "Number of edges in the graph")
+    ("edge-count,e"  , bpo::value<AbstractUGraph::size_type>(), "Number of edges in the graph, every such graph equally likely: G(n, m)")
+    ("probability,p" , bpo::value<double>(), "Instead of an edge count, include each possible edge with this probability: G(n, p)")
+    ("seed"          , bpo::value<std::uint64_t>()->default_value(1), "Random seed; a seed gives the same graph on any number of threads")
+    ("threads,t"     , bpo::value<size_t>()->default_value(0), "Threads generating the graph; 0 means one per hardware thread")
+    ("binary-output,o", bpo::value<string>(), "Write the graph to this file in the binary CSR format instead of printing an edge list")
     ;
 
   // the positional arguments are vertex-count and edge-count
@@ -71,19 +82,53 @@ int main( int argc, char **argv )
     std::exit(EXIT_FAILURE);
   }
 
-  size_type const v = vm["vertex-count"].as<size_type>();
-  size_type const e = vm["edge-count"].as<size_type>();
+  if ( !vm.count("vertex-count") || vm.count("edge-count") == vm.count("probability") ) {
+    cout << "*** Give a vertex count, and either an edge count or an edge probability" << endl;
+    std::exit(EXIT_FAILURE);
+  }
 
-  AbstractUGraph * gptr;
-  if ( vm.count("matrix") )
-    gptr = new AMUGraph(v);
-  else
-    gptr = new ALUGraph(v);
+  if ( vm.count("dupe-edges") && vm.count("probability") ) {
+    cout << "*** Can't use duplicate edges with an edge probability" << endl;
+    std::exit(EXIT_FAILURE);
+  }
 
-  GraphGenerator gen( gptr );
-  gen.allowSelfLoops( vm.count("self-loop") );
-  gen.allowDuplicateEdges( vm.count("dupe-edges") );
-  gen.addEdges( e );
+  size_type const v = vm["vertex-count"].as<size_type>();
+  std::uint64_t const seed = vm["seed"].as<std::uint64_t>();
+  bool const self_loops = vm.count("self-loop");
+
+  // each chunk of edges is drawn by its own random stream
+  std::vector<AbstractUGraph::EdgeList> edges;
+  try {
+    ThreadPool pool( vm["threads"].as<size_t>() );
+    if ( vm.count("probability") )
+      edges = RandomGraphs::gnp( v, vm["probability"].as<double>(), seed, pool, self_loops );
+    else
+      edges = RandomGraphs::gnm( v, vm["edge-count"].as<size_type>(), seed, pool, self_loops, vm.count("dupe-edges") );
+  } catch ( std::exception const& e ) {
+    std::cerr << "*** " << e.what() << endl;
+    std::exit(EXIT_FAILURE);
+  }
 
-  cout << gen.getGraph().toInputString();
+  // the matrix is filled edge by edge; lists are built straight from the chunks
+  try {
+    if ( vm.count("matrix") ) {
+      AMUGraph graph( v );
+      for ( auto const& chunk : edges )
+        for ( auto const& edge : chunk )
+          graph.addEdge( edge.first, edge.second );
+      if ( vm.count("binary-output") )
+        BinaryGraphFormat::write( CSRUGraph(graph), vm["binary-output"].as<string>() );
+      else
+        GraphWriter( cout ).writeEdgeList( graph );
+    } else {
+      CSRUGraph const graph( v, edges );
+      if ( vm.count("binary-output") )
+        BinaryGraphFormat::write( graph, vm["binary-output"].as<string>() );
+      else
+        GraphWriter( cout ).writeEdgeList( graph );
+    }
+  } catch ( std::exception const& e ) {
+    std::cerr << "*** " << e.what() << endl;
+    std::exit(EXIT_FAILURE);
+  }
 }
@@ -0,0 +1,160 @@
+/** \file GraphLoadDriver.cpp
+ * Load generator for the graph server
+ *
+ * \author Brian Heim
+ * \date   2026-10-17
+ */
+
+#include "GraphQuery.hpp"
+#include "LatencySummary.hpp"
+#include "UnixSocket.hpp"
+
+#include <boost/program_options.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint> // uint64_t
+#include <exception> // exception_ptr, rethrow_exception
+#include <iostream>
+#include <random>
+#include <sstream> // istringstream
+#include <stdexcept> // invalid_argument, runtime_error
+#include <string> // string, getline
+#include <thread>
+#include <utility> // move
+#include <vector>
+
+using std::string;
+using std::cout;
+using std::endl;
+using std::vector;
+
+namespace bpo = boost::program_options;
+
+void parseProgramOptions( int argc, char **argv, bpo::options_description& desc, bpo::variables_map& vm )
+{
+  desc.add_options()
+    ("help,h"      , "Show this message")
+    ("socket,s"    , bpo::value<string>()->default_value("graph.sock"), "Path of the graph server's Unix domain socket")
+    ("clients,c"   , bpo::value<size_t>()->default_value(4), "Concurrent connections, each on its own thread")
+    ("requests,n"  , bpo::value<size_t>()->default_value(10000), "Queries sent by each connection")
+    ("mix,m"       , bpo::value<string>()->default_value("reach,connected,path"), "Comma-separated kinds of query to choose from at random: reach, connected, path, cycle, size")
+    ("seed"        , bpo::value<std::uint64_t>()->default_value(1), "Seed for the random queries; connection i uses seed + i")
+    ;
+
+  bpo::store( bpo::parse_command_line(argc, argv, desc), vm );
+  bpo::notify( vm );
+}
+
+/// The kinds of query named in `mix`
+vector<GraphQuery::Kind> parseMix( string const& mix )
+{
+  vector<GraphQuery::Kind> kinds;
+  std::istringstream in( mix );
+  string name;
+  while ( std::getline( in, name, ',' ) ) {
+    if ( name == "reach" )
+      kinds.push_back( GraphQuery::Kind::Reach );
+    else if ( name == "connected" )
+      kinds.push_back( GraphQuery::Kind::Connected );
+    else if ( name == "path" )
+      kinds.push_back( GraphQuery::Kind::Path );
+    else if ( name == "cycle" )
+      kinds.push_back( GraphQuery::Kind::Cycle );
+    else if ( name == "size" )
+      kinds.push_back( GraphQuery::Kind::Size );
+    else
+      throw std::invalid_argument( "unknown query '" + name + "'" );
+  }
+  if ( kinds.empty() )
+    throw std::invalid_argument( "no kinds of query in '" + mix + "'" );
+  return kinds;
+}
+
+/// Sends `query` and waits for the answer
+GraphQuery::Answer ask( UnixSocket const& server, GraphQuery::Query const& query, string& message )
+{
+  server.sendMessage( GraphQuery::encode( query ) );
+  if ( !server.receiveMessage( message ) )
+    throw std::runtime_error( "The server closed the connection" );
+  return GraphQuery::decodeAnswer( query.kind, message );
+}
+
+int main( int argc, char **argv )
+{
+  bpo::options_description desc( "Allowed options" );
+  bpo::variables_map vm;
+  parseProgramOptions( argc, argv, desc, vm );
+
+  // if help is requested, just print help and exit
+  if ( vm.count("help") ) {
+    cout << desc << endl;
+    std::exit( EXIT_SUCCESS );
+  }
+
+  string const path = vm["socket"].as<string>();
+  size_t const clients = vm["clients"].as<size_t>();
+  size_t const requests = vm["requests"].as<size_t>();
+  std::uint64_t const seed = vm["seed"].as<std::uint64_t>();
+
+  try {
+    vector<GraphQuery::Kind> const kinds = parseMix( vm["mix"].as<string>() );
+
+    // queries are about vertices the graph has
+    string message;
+    GraphQuery::Query const size_query = { GraphQuery::Kind::Size, 0, 0 };
+    GraphQuery::Answer const size = ask( UnixSocket::connect( path ), size_query, message );
+    if ( !size.error.empty() || size.vertex_count == 0 )
+      throw std::runtime_error( "The server's graph has no vertices" );
+    cout << "Graph with " << size.vertex_count << " vertices and " << size.edge_count << " edges; "
+         << clients << " connections of " << requests << " queries each" << endl;
+
+    // each connection records its own latencies, merged at the end
+    vector<vector<double>> latencies( clients );
+    std::atomic<size_t> errors( 0 );
+    vector<std::exception_ptr> failures( clients );
+    vector<std::thread> threads;
+    auto const start = std::chrono::steady_clock::now();
+    for ( size_t c = 0; c < clients; ++c ) {
+      threads.emplace_back( [&, c] {
+        try {
+          UnixSocket const server = UnixSocket::connect( path );
+          std::mt19937_64 engine( seed + c );
+          std::uniform_int_distribution<GraphQuery::VertexID> pick_vertex( 0, GraphQuery::VertexID(size.vertex_count - 1) );
+          std::uniform_int_distribution<size_t> pick_kind( 0, kinds.size() - 1 );
+          string buffer;
+          latencies[c].reserve( requests );
+          for ( size_t r = 0; r < requests; ++r ) {
+            GraphQuery::Query const query = { kinds[pick_kind(engine)], pick_vertex(engine), pick_vertex(engine) };
+            auto const sent = std::chrono::steady_clock::now();
+            GraphQuery::Answer const answer = ask( server, query, buffer );
+            latencies[c].push_back( std::chrono::duration<double>( std::chrono::steady_clock::now() - sent ).count() );
+            if ( !answer.error.empty() )
+              ++errors;
+          }
+        } catch ( ... ) {
+          failures[c] = std::current_exception();
+        }
+      } );
+    }
+    for ( auto& thread : threads )
+      thread.join();
+    double const wall = std::chrono::duration<double>( std::chrono::steady_clock::now() - start ).count();
+
+    for ( auto const& failure : failures )
+      if ( failure )
+        std::rethrow_exception( failure );
+
+    vector<double> all;
+    for ( auto const& connection : latencies )
+      all.insert( all.end(), connection.begin(), connection.end() );
+    cout << LatencySummary::of( std::move(all), wall );
+    if ( errors > 0 )
+      cout << errors << " queries were answered with errors" << endl;
+  } catch ( std::exception const& e ) {
+    std::cerr << "*** " << e.what() << endl;
+    std::exit( EXIT_FAILURE );
+  }
+
+  std::exit( EXIT_SUCCESS );
+}
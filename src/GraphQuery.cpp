@@ -0,0 +1,287 @@
+/** \file GraphQuery.cpp
+ * Queries about a graph and their answers, as text and binary messages.
+ *
+ * \author Brian Heim
+ * \date   2026-10-17
+ */
+
+#include "GraphQuery.hpp"
+
+#include <cstdint> // uint8_t, uint64_t
+#include <limits> // numeric_limits
+#include <sstream> // istringstream
+#include <stdexcept> // invalid_argument, runtime_error
+#include <string> // string, to_string
+
+using std::string;
+using std::uint8_t;
+using std::uint64_t;
+
+namespace {
+
+/// Number of vertex IDs each kind of query takes
+size_t vertexArguments( GraphQuery::Kind const kind )
+{
+  switch ( kind ) {
+  case GraphQuery::Kind::Reach:     return 1;
+  case GraphQuery::Kind::Connected: return 2;
+  case GraphQuery::Kind::Path:      return 2;
+  default:                          return 0;
+  }
+}
+
+char const* kindName( GraphQuery::Kind const kind )
+{
+  switch ( kind ) {
+  case GraphQuery::Kind::Reach:     return "reach";
+  case GraphQuery::Kind::Connected: return "connected";
+  case GraphQuery::Kind::Path:      return "path";
+  case GraphQuery::Kind::Cycle:     return "cycle";
+  case GraphQuery::Kind::Size:      return "size";
+  }
+  return "?";
+}
+
+void putVarint( uint64_t value, string& out )
+{
+  while ( value >= 0x80 ) {
+    out.push_back( char((value & 0x7f) | 0x80) );
+    value >>= 7;
+  }
+  out.push_back( char(value) );
+}
+
+/// Reads binary messages, throwing on anything past the end
+class Reader
+{
+public:
+  explicit Reader( string const& message ) : _message(message), _position(0) { }
+
+  uint8_t byte()
+  {
+    if ( _position >= _message.size() )
+      throw std::runtime_error( "Truncated graph query message" );
+    return uint8_t( _message[_position++] );
+  }
+
+  uint64_t varint()
+  {
+    uint64_t value = 0;
+    for ( unsigned shift = 0; shift < 64; shift += 7 ) {
+      uint8_t const b = byte();
+      value |= uint64_t(b & 0x7f) << shift;
+      if ( !(b & 0x80) )
+        return value;
+    }
+    throw std::runtime_error( "Overlong varint in graph query message" );
+  }
+
+  string rest() { string const s = _message.substr( _position ); _position = _message.size(); return s; }
+
+  void expectEnd() const
+  {
+    if ( _position != _message.size() )
+      throw std::runtime_error( "Trailing bytes in graph query message" );
+  }
+
+private:
+  string const& _message;
+  size_t _position;
+};
+
+/// `value` as a vertex ID, checked before it's narrowed so an ID too big
+/// for this build can't wrap around to a vertex that exists
+template<class Error>
+GraphQuery::VertexID toVertexID( uint64_t const value )
+{
+  if ( value > std::numeric_limits<GraphQuery::VertexID>::max() )
+    throw Error( "no vertex " + std::to_string(value) + " in the graph" );
+  return GraphQuery::VertexID( value );
+}
+
+void writeVertices( std::ostream& out, std::vector<GraphQuery::VertexID> const& vertices, bool const closed )
+{
+  if ( vertices.empty() ) {
+    out << "-1\t";
+    return;
+  }
+  // a path of n vertices has n - 1 edges; a cycle closes back to its first
+  out << (closed ? vertices.size() : vertices.size() - 1) << '\t';
+  for ( size_t i = 0; i < vertices.size(); ++i )
+    out << (i ? " " : "") << vertices[i];
+}
+
+} // namespace
+
+namespace GraphQuery {
+
+Query parse( string const& line )
+{
+  std::istringstream in( line );
+  string name;
+  in >> name;
+
+  Query query = Query();
+  if ( name == "reach" )
+    query.kind = Kind::Reach;
+  else if ( name == "connected" )
+    query.kind = Kind::Connected;
+  else if ( name == "path" )
+    query.kind = Kind::Path;
+  else if ( name == "cycle" )
+    query.kind = Kind::Cycle;
+  else if ( name == "size" )
+    query.kind = Kind::Size;
+  else
+    throw std::invalid_argument( "unknown query '" + name + "'" );
+
+  size_t const count = vertexArguments( query.kind );
+  VertexID* const vertices[2] = { &query.u, &query.v };
+  for ( size_t i = 0; i < count; ++i ) {
+    uint64_t vertex;
+    if ( !(in >> vertex) )
+      throw std::invalid_argument( name + " expects " + std::to_string(count) + " vertex IDs" );
+    *vertices[i] = toVertexID<std::invalid_argument>( vertex );
+  }
+  string rest;
+  if ( in >> rest )
+    throw std::invalid_argument( "unexpected '" + rest + "' after " + name + " query" );
+  return query;
+}
+
+bool isBlank( string const& line )
+{
+  size_t const first = line.find_first_not_of( " \t\r" );
+  return first == string::npos || line[first] == '#';
+}
+
+void write( std::ostream& out, Query const& query, Answer const& answer, size_type const line )
+{
+  if ( !answer.error.empty() ) {
+    writeError( out, line, answer.error );
+    return;
+  }
+
+  out << kindName( query.kind );
+  switch ( query.kind ) {
+  case Kind::Reach:
+    out << '\t' << query.u << '\t' << answer.reach;
+    break;
+  case Kind::Connected:
+    out << '\t' << query.u << '\t' << query.v << '\t' << (answer.connected ? 1 : 0);
+    break;
+  case Kind::Path:
+    out << '\t' << query.u << '\t' << query.v << '\t';
+    writeVertices( out, answer.vertices, false );
+    break;
+  case Kind::Cycle:
+    out << '\t';
+    writeVertices( out, answer.vertices, true );
+    break;
+  case Kind::Size:
+    out << '\t' << answer.vertex_count << '\t' << answer.edge_count;
+    break;
+  }
+  out << '\n';
+}
+
+void writeError( std::ostream& out, size_type const line, string const& message )
+{
+  out << "error\t" << line << '\t' << message << '\n';
+}
+
+string encode( Query const& query )
+{
+  string message( 1, char(query.kind) );
+  size_t const count = vertexArguments( query.kind );
+  if ( count > 0 )
+    putVarint( query.u, message );
+  if ( count > 1 )
+    putVarint( query.v, message );
+  return message;
+}
+
+string encode( Kind const kind, Answer const& answer )
+{
+  if ( !answer.error.empty() )
+    return string( 1, char(1) ) + answer.error;
+
+  string message( 1, char(0) );
+  switch ( kind ) {
+  case Kind::Reach:
+    putVarint( answer.reach, message );
+    break;
+  case Kind::Connected:
+    message.push_back( char(answer.connected ? 1 : 0) );
+    break;
+  case Kind::Path:
+  case Kind::Cycle:
+    putVarint( answer.vertices.size(), message );
+    for ( auto const v : answer.vertices )
+      putVarint( v, message );
+    break;
+  case Kind::Size:
+    putVarint( answer.vertex_count, message );
+    putVarint( answer.edge_count, message );
+    break;
+  }
+  return message;
+}
+
+Query decodeQuery( string const& message )
+{
+  Reader reader( message );
+  Query query = Query();
+  uint8_t const kind = reader.byte();
+  if ( kind > uint8_t(Kind::Size) )
+    throw std::runtime_error( "Unknown graph query kind " + std::to_string(kind) );
+  query.kind = Kind(kind);
+
+  size_t const count = vertexArguments( query.kind );
+  if ( count > 0 )
+    query.u = toVertexID<std::runtime_error>( reader.varint() );
+  if ( count > 1 )
+    query.v = toVertexID<std::runtime_error>( reader.varint() );
+  reader.expectEnd();
+  return query;
+}
+
+Answer decodeAnswer( Kind const kind, string const& message )
+{
+  Reader reader( message );
+  Answer answer = Answer();
+  if ( reader.byte() != 0 ) {
+    answer.error = reader.rest();
+    if ( answer.error.empty() )
+      answer.error = "unknown error";
+    return answer;
+  }
+
+  switch ( kind ) {
+  case Kind::Reach:
+    answer.reach = reader.varint();
+    break;
+  case Kind::Connected:
+    answer.connected = reader.byte() != 0;
+    break;
+  case Kind::Path:
+  case Kind::Cycle: {
+    uint64_t const count = reader.varint();
+    // every vertex takes at least a byte, so a bad count can't over-allocate
+    if ( count > message.size() )
+      throw std::runtime_error( "Truncated graph query message" );
+    answer.vertices.resize( count );
+    for ( auto& v : answer.vertices )
+      v = toVertexID<std::runtime_error>( reader.varint() );
+    break;
+  }
+  case Kind::Size:
+    answer.vertex_count = reader.varint();
+    answer.edge_count = reader.varint();
+    break;
+  }
+  reader.expectEnd();
+  return answer;
+}
+
+} // namespace GraphQuery
@@ -0,0 +1,401 @@
+/** \file GraphServerDriver.cpp
+ * Serves queries about one graph over a Unix domain socket
+ *
+ * \author Brian Heim
+ * \date   2026-10-17
+ */
+
+#include "AbstractUGraph.hpp"
+#include "BinaryGraphFormat.hpp"
+#include "CSRUGraph.hpp"
+#include "EdgeListLoader.hpp"
+#include "GraphQuery.hpp"
+#include "QueryEngine.hpp"
+#include "ThreadPool.hpp"
+#include "UnixSocket.hpp"
+
+#include <boost/program_options.hpp>
+
+#include <atomic>
+#include <cerrno> // errno
+#include <condition_variable>
+#include <csignal> // signal, sig_atomic_t
+#include <cstdint> // uint32_t
+#include <deque>
+#include <iostream>
+#include <map>
+#include <mutex> // mutex, lock_guard, unique_lock
+#include <stdexcept> // runtime_error
+#include <string> // string
+#include <system_error> // system_error
+#include <thread>
+#include <utility> // move, pair
+#include <vector>
+
+#include <fcntl.h> // fcntl
+#include <poll.h> // poll
+#include <unistd.h> // pipe, read, write, unlink
+
+using std::string;
+using std::cin;
+using std::cout;
+using std::endl;
+using std::vector;
+
+using VertexID = AbstractUGraph::VertexID;
+namespace bpo = boost::program_options;
+
+namespace {
+
+/// Write end of the pipe that wakes the polling thread; -1 until open
+int wake_fd = -1;
+
+/// Set by SIGINT and SIGTERM
+volatile std::sig_atomic_t stop_requested = 0;
+
+/// Wakes the polling thread. Safe in a signal handler; if the pipe is
+/// full, a wakeup is already pending.
+void wake()
+{
+  char const byte = 0;
+  ssize_t const written = ::write( wake_fd, &byte, 1 );
+  (void)written;
+}
+
+extern "C" void requestStop( int )
+{
+  stop_requested = 1;
+  wake();
+}
+
+/// Makes the pipe end `fd` close on exec and never wait
+void configurePipe( int const fd )
+{
+  int const flags = ::fcntl( fd, F_GETFL );
+  if ( ::fcntl( fd, F_SETFD, FD_CLOEXEC ) != 0 || flags < 0 || ::fcntl( fd, F_SETFL, flags | O_NONBLOCK ) != 0 )
+    throw std::system_error( errno, std::system_category(), "Can't configure wake pipe" );
+}
+
+} // namespace
+
+/// Serves queries about a graph to the clients of a listening socket.
+///
+/// One thread polls the listening socket and every idle client, gathers
+/// each request from whatever bytes have arrived and queues it once whole;
+/// each worker answers queued requests with its own workspace of the
+/// engine and sends the response itself. A client isn't polled while its
+/// request is queued or being answered, so its responses come back in
+/// order. Client sockets never block the polling thread: a client that
+/// stalls mid-request only holds its own partial request, and one that
+/// announces a request longer than `MAX_REQUEST` is dropped.
+class GraphServer
+{
+public:
+  /// Longest request accepted: a kind byte and two ten-byte varints fit
+  static constexpr std::uint32_t MAX_REQUEST = 32;
+
+  GraphServer( QueryEngine<CSRUGraph>& engine, UnixSocket& listener ) :
+    _engine(engine),
+    _listener(listener),
+    _stopping(false),
+    _answered(0)
+  {
+    int fds[2];
+    if ( ::pipe( fds ) != 0 )
+      throw std::system_error( errno, std::system_category(), "Can't create wake pipe" );
+    _wake_read = fds[0];
+    wake_fd = fds[1];
+    configurePipe( _wake_read );
+    configurePipe( wake_fd );
+  }
+
+  GraphServer( GraphServer const& ) = delete;
+  GraphServer& operator=( GraphServer const& ) = delete;
+
+  ~GraphServer()
+  {
+    ::close( _wake_read );
+    ::close( wake_fd );
+    wake_fd = -1;
+  }
+
+  /// Serves until SIGINT or SIGTERM
+  void run()
+  {
+    vector<std::thread> workers;
+    for ( size_t worker = 0; worker < _engine.workers(); ++worker )
+      workers.emplace_back( [this, worker] { work( worker ); } );
+
+    vector<pollfd> polled;
+    while ( !stop_requested ) {
+      polled.clear();
+      polled.push_back( pollfd{ _listener.fd(), POLLIN, 0 } );
+      polled.push_back( pollfd{ _wake_read, POLLIN, 0 } );
+      for ( auto const& client : _clients )
+        if ( !client.second.busy )
+          polled.push_back( pollfd{ client.first, POLLIN, 0 } );
+
+      if ( ::poll( polled.data(), polled.size(), -1 ) < 0 ) {
+        if ( errno == EINTR )
+          continue;
+        throw std::system_error( errno, std::system_category(), "Can't poll sockets" );
+      }
+
+      if ( polled[1].revents )
+        finishResponses();
+      if ( polled[0].revents & POLLIN )
+        acceptClient();
+      for ( size_t i = 2; i < polled.size(); ++i )
+        if ( polled[i].revents )
+          readRequest( polled[i].fd );
+    }
+
+    {
+      std::lock_guard<std::mutex> lock( _jobs_mutex );
+      _stopping = true;
+    }
+    _jobs_ready.notify_all();
+    for ( auto& worker : workers )
+      worker.join();
+  }
+
+  /// Number of queries answered so far
+  size_t answered() const { return _answered.load(); }
+
+private:
+
+  /// A connection, the part of its next request read so far, and whether
+  /// its request is with the workers
+  struct Client
+  {
+    UnixSocket socket;
+    string pending;
+    bool busy;
+  };
+
+  /// A request for the workers; an undecodable one carries its error
+  struct Job
+  {
+    int fd;
+    UnixSocket const* socket;
+    GraphQuery::Query query;
+    string error;
+  };
+
+  void acceptClient()
+  {
+    try {
+      UnixSocket socket = _listener.accept();
+      socket.setNonBlocking( true );
+      int const fd = socket.fd();
+      _clients[fd] = Client{ std::move(socket), string(), false };
+    } catch ( std::system_error const& e ) {
+      std::cerr << "*** " << e.what() << endl;
+    }
+  }
+
+  /// Reads what has arrived of a client's request, up to its end, and
+  /// queues the request once it's whole
+  void readRequest( int const fd )
+  {
+    Client& client = _clients.at( fd );
+    size_t const header = UnixSocket::HEADER_SIZE;
+    char buffer[UnixSocket::HEADER_SIZE + MAX_REQUEST];
+
+    // never read past this request, so the next one waits in the socket
+    size_t wanted = header - client.pending.size();
+    if ( client.pending.size() >= header )
+      wanted = header + UnixSocket::messageLength( client.pending.data() ) - client.pending.size();
+    long received;
+    try {
+      received = client.socket.receiveAvailable( buffer, wanted );
+    } catch ( std::system_error const& ) {
+      received = 0;
+    }
+    if ( received == 0 ) {
+      _clients.erase( fd );
+      return;
+    }
+    if ( received < 0 )
+      return;
+    client.pending.append( buffer, received );
+
+    if ( client.pending.size() < header )
+      return;
+    uint32_t const size = UnixSocket::messageLength( client.pending.data() );
+    if ( size > MAX_REQUEST ) {
+      _clients.erase( fd );
+      return;
+    }
+    if ( client.pending.size() < header + size )
+      return;
+    string const message = client.pending.substr( header );
+    client.pending.clear();
+
+    Job job = { fd, &client.socket, GraphQuery::Query(), string() };
+    try {
+      job.query = GraphQuery::decodeQuery( message );
+    } catch ( std::runtime_error const& e ) {
+      job.error = e.what();
+    }
+
+    client.busy = true;
+    {
+      std::lock_guard<std::mutex> lock( _jobs_mutex );
+      _jobs.push_back( std::move(job) );
+    }
+    _jobs_ready.notify_one();
+  }
+
+  /// Polls clients again once their responses are sent, and drops those
+  /// that couldn't be sent to
+  void finishResponses()
+  {
+    char buffer[256];
+    while ( ::read( _wake_read, buffer, sizeof buffer ) > 0 )
+      ;
+
+    vector<std::pair<int, bool>> done;
+    {
+      std::lock_guard<std::mutex> lock( _done_mutex );
+      done.swap( _done );
+    }
+    for ( auto const& response : done ) {
+      if ( response.second )
+        _clients.at( response.first ).busy = false;
+      else
+        _clients.erase( response.first );
+    }
+  }
+
+  /// Answers queued requests with the engine workspace of `worker`
+  void work( size_t const worker )
+  {
+    for ( ;; ) {
+      Job job;
+      {
+        std::unique_lock<std::mutex> lock( _jobs_mutex );
+        _jobs_ready.wait( lock, [this] { return _stopping || !_jobs.empty(); } );
+        if ( _jobs.empty() )
+          return;
+        job = std::move( _jobs.front() );
+        _jobs.pop_front();
+      }
+
+      GraphQuery::Answer answer = GraphQuery::Answer();
+      if ( job.error.empty() )
+        answer = _engine.answer( job.query, worker );
+      else
+        answer.error = job.error;
+
+      bool sent = true;
+      try {
+        job.socket->sendMessage( GraphQuery::encode( job.query.kind, answer ) );
+        ++_answered;
+      } catch ( std::system_error const& ) {
+        sent = false;
+      }
+
+      {
+        std::lock_guard<std::mutex> lock( _done_mutex );
+        _done.emplace_back( job.fd, sent );
+      }
+      wake();
+    }
+  }
+
+  QueryEngine<CSRUGraph>& _engine;
+  UnixSocket& _listener;
+  int _wake_read;
+
+  std::map<int, Client> _clients; ///< by descriptor; only the polling thread changes it
+
+  std::mutex _jobs_mutex;
+  std::condition_variable _jobs_ready;
+  std::deque<Job> _jobs;
+  bool _stopping;
+
+  std::mutex _done_mutex;
+  vector<std::pair<int, bool>> _done; ///< clients responded to, and whether it worked
+
+  std::atomic<size_t> _answered;
+};
+
+void parseProgramOptions( int argc, char **argv, bpo::options_description& desc, bpo::variables_map& vm )
+{
+  desc.add_options()
+    ("help,h"      , "Show this message")
+    ("input-file,i", "Input file to read, as an edge list or a binary graph")
+    ("socket,s"    , bpo::value<string>()->default_value("graph.sock"), "Path of the Unix domain socket to listen on")
+    ("threads,t"   , bpo::value<size_t>()->default_value(0), "Worker threads answering queries; 0 means one per hardware thread")
+    ;
+
+  // the positional argument is input-file
+  bpo::positional_options_description pod;
+  pod.add( "input-file", 1 );
+
+  bpo::store(
+      bpo::command_line_parser(argc, argv).options(desc).positional(pod).run(),
+      vm
+      );
+  bpo::notify( vm );
+}
+
+CSRUGraph parseGraph( bpo::variables_map& vm )
+{
+  try {
+    if ( vm.count("input-file") ) {
+      string filename = vm["input-file"].as<string>();
+      // binary graphs are mapped and used in place; text is parsed in parallel
+      if ( BinaryGraphFormat::isBinaryGraphFile(filename) )
+        return BinaryGraphFormat::map( filename );
+      return EdgeListLoader( filename ).build<CSRUGraph>();
+    } else {
+      return CSRUGraph( cin );
+    }
+  } catch ( std::exception const& e ) {
+    std::cerr << "*** " << e.what() << endl;
+    std::exit( EXIT_FAILURE );
+  }
+}
+
+int main( int argc, char **argv )
+{
+  bpo::options_description desc( "Allowed options" );
+  bpo::variables_map vm;
+  parseProgramOptions( argc, argv, desc, vm );
+
+  // if help is requested, just print help and exit
+  if ( vm.count("help") ) {
+    cout << desc << endl;
+    std::exit( EXIT_SUCCESS );
+  }
+
+  CSRUGraph ug = parseGraph( vm );
+  string const path = vm["socket"].as<string>();
+  size_t threads = vm["threads"].as<size_t>();
+  if ( threads == 0 )
+    threads = ThreadPool::defaultThreadCount();
+
+  try {
+    QueryEngine<CSRUGraph> engine( ug, threads );
+    UnixSocket listener = UnixSocket::listen( path );
+    GraphServer server( engine, listener );
+
+    std::signal( SIGINT, requestStop );
+    std::signal( SIGTERM, requestStop );
+    // sockets refuse SIGPIPE themselves where they can; this covers the rest
+    std::signal( SIGPIPE, SIG_IGN );
+    std::cerr << "Serving " << ug.v() << " vertices and " << ug.e() << " edges on " << path
+              << " with " << threads << " workers" << endl;
+
+    server.run();
+    ::unlink( path.c_str() );
+    std::cerr << "Answered " << server.answered() << " queries" << endl;
+  } catch ( std::exception const& e ) {
+    std::cerr << "*** " << e.what() << endl;
+    std::exit( EXIT_FAILURE );
+  }
+
+  std::exit( EXIT_SUCCESS );
+}
@@ -0,0 +1,64 @@
+/** \file GraphWriter.cpp
+ * Streaming, buffered output of graphs in the text formats.
+ *
+ * \author Brian Heim
+ * \date   2026-10-17
+ */
+
+#include "GraphWriter.hpp"
+
+#include <cerrno> // errno
+#include <stdexcept> // runtime_error
+#include <system_error> // system_error
+
+#include <unistd.h> // write
+
+GraphWriter::GraphWriter( int const fd, size_t const thread_count ) :
+  _fd(fd),
+  _out(nullptr),
+  _pool(thread_count),
+  _buffers(_pool.size())
+{ }
+
+GraphWriter::GraphWriter( std::ostream& out, size_t const thread_count ) :
+  _fd(-1),
+  _out(&out),
+  _pool(thread_count),
+  _buffers(_pool.size())
+{ }
+
+void GraphWriter::writeEdgeList( AbstractUGraph const& graph )
+{
+  writeChunks( graph, [&]( VertexID const v ) { return graph.verticesAdjacentTo( v ); }, Layout::EdgeList );
+}
+
+void GraphWriter::writeAdjacencyLists( AbstractUGraph const& graph )
+{
+  writeChunks( graph, [&]( VertexID const v ) { return graph.verticesAdjacentTo( v ); }, Layout::AdjacencyLists );
+}
+
+void GraphWriter::writeBytes( char const* data, size_t size )
+{
+  if ( _out ) {
+    if ( !_out->write( data, size ) )
+      throw std::runtime_error( "GraphWriter: the output stream failed" );
+    return;
+  }
+
+  while ( size > 0 ) {
+    ssize_t const written = ::write( _fd, data, size );
+    if ( written < 0 ) {
+      if ( errno == EINTR )
+        continue;
+      throw std::system_error( errno, std::system_category(), "GraphWriter: write failed" );
+    }
+    data += written;
+    size -= written;
+  }
+}
+
+void GraphWriter::flush()
+{
+  if ( _out && !_out->flush() )
+    throw std::runtime_error( "GraphWriter: the output stream failed" );
+}
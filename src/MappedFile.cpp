@@ -0,0 +1,62 @@
+/** \file MappedFile.cpp
+ * Read-only memory mapping of a whole file.
+ *
+ * \author Brian Heim
+ * \date   2026-10-17
+ */
+
+#include "MappedFile.hpp"
+
+#include <cerrno> // errno
+#include <string> // string
+#include <system_error> // system_error
+
+#include <fcntl.h> // open
+#include <sys/mman.h> // mmap
+#include <sys/stat.h> // fstat
+#include <unistd.h> // close
+
+using std::string;
+using std::system_error;
+using std::system_category;
+
+MappedFile::MappedFile( string const& filename, Access const access ) :
+  _filename(filename),
+  _data(nullptr),
+  _size(0)
+{
+  int const fd = ::open( filename.c_str(), O_RDONLY );
+  if ( fd < 0 )
+    throw system_error( errno, system_category(), "Can't open " + filename );
+
+  struct stat info;
+  if ( ::fstat(fd, &info) != 0 ) {
+    int const error = errno;
+    ::close( fd );
+    throw system_error( error, system_category(), "Can't stat " + filename );
+  }
+
+  _size = info.st_size;
+
+  // mmap rejects zero-length mappings; an empty file just has no data
+  if ( _size > 0 ) {
+    void* const mapping = ::mmap( nullptr, _size, PROT_READ, MAP_PRIVATE, fd, 0 );
+    if ( mapping == MAP_FAILED ) {
+      int const error = errno;
+      ::close( fd );
+      throw system_error( error, system_category(), "Can't map " + filename );
+    }
+    _data = static_cast<char const*>( mapping );
+
+    ::madvise( mapping, _size, access == Access::Sequential ? MADV_SEQUENTIAL : MADV_RANDOM );
+  }
+
+  // the mapping stays valid after the descriptor is closed
+  ::close( fd );
+}
+
+MappedFile::~MappedFile()
+{
+  if ( _data )
+    ::munmap( const_cast<char*>(_data), _size );
+}
@@ -0,0 +1,274 @@
+/** \file RandomGraphs.cpp
+ * Erdős–Rényi random graphs, generated in parallel and reproducibly.
+ *
+ * \author Brian Heim
+ * \date   2026-10-17
+ */
+
+#include "RandomGraphs.hpp"
+
+#include <algorithm> // sort, unique, remove, upper_bound, min
+#include <cmath> // floor, log1p, sqrt
+#include <cstdint> // uint32_t, uint64_t
+#include <limits> // numeric_limits
+#include <memory> // unique_ptr
+#include <random>
+#include <stdexcept> // domain_error
+#include <string> // to_string
+#include <vector>
+
+using std::to_string;
+using std::uint32_t;
+using std::uint64_t;
+using std::vector;
+
+typedef AbstractUGraph::VertexID VertexID;
+typedef AbstractUGraph::Edge Edge;
+
+namespace {
+
+/// Marks a drawn pair that has been dropped again
+constexpr uint64_t DROPPED = std::numeric_limits<uint64_t>::max();
+
+/// k(k-1)/2, the number of possible edges in the rows before row k,
+/// without overflowing
+uint64_t triangle( uint64_t const k )
+{
+  return k % 2 == 0 ? (k / 2) * (k - 1) : k * ((k - 1) / 2);
+}
+
+/// The possible edge numbered `pair`
+Edge decode( uint64_t const pair, bool const self_loops )
+{
+  // find k with triangle(k) <= pair < triangle(k + 1), starting from the
+  // floating-point estimate; the row is k, or k - 1 with self-loops
+  uint64_t k = uint64_t( std::sqrt( 2.0 * double(pair) ) );
+  while ( k > 1 && triangle(k) > pair )
+    --k;
+  while ( triangle(k + 1) <= pair )
+    ++k;
+  uint64_t const v = self_loops ? k - 1 : k;
+  return Edge( VertexID(pair - triangle(k)), VertexID(v) );
+}
+
+/// First possible edge of `block`; block `STREAM_COUNT` is the end
+uint64_t blockBegin( uint64_t const pairs, size_t const block )
+{
+  uint64_t const size = pairs / RandomGraphs::STREAM_COUNT;
+  uint64_t const extra = pairs % RandomGraphs::STREAM_COUNT;
+  return block * size + std::min<uint64_t>( block, extra );
+}
+
+/// The random stream of `block`; block `STREAM_COUNT` is for sequential
+/// decisions about every block
+std::mt19937_64 stream( uint64_t const seed, size_t const block )
+{
+  std::seed_seq seq{ uint32_t(seed), uint32_t(seed >> 32), uint32_t(block) };
+  return std::mt19937_64( seq );
+}
+
+/// Possible edges drawn by each block's stream, by number
+class PairDraws
+{
+public:
+  PairDraws( uint64_t const pairs, uint64_t const seed, ThreadPool& pool ) :
+    _pairs(pairs),
+    _seed(seed),
+    _pool(pool),
+    _picked(RandomGraphs::STREAM_COUNT),
+    _streams(RandomGraphs::STREAM_COUNT),
+    _splitter(stream( seed, RandomGraphs::STREAM_COUNT ))
+  { }
+
+  /// Draws `count` pairs uniformly, with repeats, and sorts each block;
+  /// with `distinct`, then drops repeats. Returns the pairs held.
+  uint64_t draw( uint64_t const count, bool const distinct )
+  {
+    // the draws landing in each block follow a multinomial distribution,
+    // taken as a binomial share of what's left for each block in turn
+    vector<uint64_t> counts( RandomGraphs::STREAM_COUNT, 0 );
+    uint64_t draws_left = count;
+    for ( size_t block = 0; block < RandomGraphs::STREAM_COUNT && draws_left > 0; ++block ) {
+      uint64_t const size = blockBegin( _pairs, block + 1 ) - blockBegin( _pairs, block );
+      uint64_t const pairs_left = _pairs - blockBegin( _pairs, block );
+      if ( size == pairs_left ) {
+        counts[block] = draws_left;
+      } else if ( size > 0 ) {
+        std::binomial_distribution<uint64_t> share( draws_left, double(size) / double(pairs_left) );
+        counts[block] = share( _splitter );
+      }
+      draws_left -= counts[block];
+    }
+
+    _pool.parallelFor( RandomGraphs::STREAM_COUNT, [&]( size_t const block, size_t ) {
+      if ( counts[block] == 0 )
+        return;
+      // seeding is most of the cost of a small graph, so only blocks that draw do it
+      if ( !_streams[block] )
+        _streams[block].reset( new std::mt19937_64( stream( _seed, block ) ) );
+      vector<uint64_t>& picked = _picked[block];
+      std::uniform_int_distribution<uint64_t> pick( blockBegin( _pairs, block ), blockBegin( _pairs, block + 1 ) - 1 );
+      picked.reserve( picked.size() + counts[block] );
+      for ( uint64_t i = 0; i < counts[block]; ++i )
+        picked.push_back( pick( *_streams[block] ) );
+      std::sort( picked.begin(), picked.end() );
+      if ( distinct )
+        picked.erase( std::unique( picked.begin(), picked.end() ), picked.end() );
+    } );
+    return held();
+  }
+
+  /// Drops `count` of the pairs held, each set of that many equally likely
+  void drop( uint64_t count )
+  {
+    vector<uint64_t> starts( 1, 0 );
+    for ( auto const& picked : _picked )
+      starts.push_back( starts.back() + picked.size() );
+
+    // the surplus is small, so redrawing an already dropped pair is rare
+    std::uniform_int_distribution<uint64_t> pick( 0, starts.back() - 1 );
+    while ( count > 0 ) {
+      uint64_t const i = pick( _splitter );
+      size_t const block = std::upper_bound( starts.begin(), starts.end(), i ) - starts.begin() - 1;
+      uint64_t& pair = _picked[block][i - starts[block]];
+      if ( pair != DROPPED ) {
+        pair = DROPPED;
+        --count;
+      }
+    }
+
+    _pool.parallelFor( RandomGraphs::STREAM_COUNT, [&]( size_t const block, size_t ) {
+      vector<uint64_t>& picked = _picked[block];
+      picked.erase( std::remove( picked.begin(), picked.end(), DROPPED ), picked.end() );
+    } );
+  }
+
+  /// Number of pairs held
+  uint64_t held() const
+  {
+    uint64_t total = 0;
+    for ( auto const& picked : _picked )
+      total += picked.size();
+    return total;
+  }
+
+  /// Sorted pairs held in `block`
+  vector<uint64_t> const& picked( size_t const block ) const { return _picked[block]; }
+
+private:
+  uint64_t _pairs;
+  uint64_t _seed;
+  ThreadPool& _pool;
+  vector<vector<uint64_t>> _picked;
+  vector<std::unique_ptr<std::mt19937_64>> _streams; ///< seeded on first use
+  std::mt19937_64 _splitter; ///< shares draws among blocks and picks what to drop
+};
+
+} // namespace
+
+namespace RandomGraphs {
+
+uint64_t pairCount( size_type const vertex_count, bool const self_loops )
+{
+  return triangle( uint64_t(vertex_count) + (self_loops ? 1 : 0) );
+}
+
+vector<EdgeList> gnp( size_type const vertex_count, double const p, uint64_t const seed,
+                      ThreadPool& pool, bool const self_loops )
+{
+  if ( !(p >= 0 && p <= 1) )
+    throw std::domain_error( "Edge probability " + to_string(p) + " is not between 0 and 1" );
+
+  uint64_t const pairs = pairCount( vertex_count, self_loops );
+  vector<EdgeList> chunks( STREAM_COUNT );
+  if ( p == 0 )
+    return chunks;
+
+  // each run of absent edges before a present one is geometric: it has
+  // length floor(log(1 - u) / log(1 - p)) for u uniform in [0, 1)
+  double const log_absent = std::log1p( -p );
+  pool.parallelFor( STREAM_COUNT, [&]( size_t const block, size_t ) {
+    uint64_t const begin = blockBegin( pairs, block );
+    uint64_t const end = blockBegin( pairs, block + 1 );
+    if ( begin == end )
+      return;
+    EdgeList& edges = chunks[block];
+    edges.reserve( size_t( double(end - begin) * p * 1.01 ) + 16 );
+
+    if ( p == 1 ) {
+      for ( uint64_t pair = begin; pair < end; ++pair )
+        edges.push_back( decode( pair, self_loops ) );
+      return;
+    }
+
+    std::mt19937_64 engine = stream( seed, block );
+    std::uniform_real_distribution<double> uniform( 0.0, 1.0 );
+    for ( uint64_t pair = begin; ; ++pair ) {
+      double const skip = std::floor( std::log1p( -uniform(engine) ) / log_absent );
+      if ( skip >= double(end - pair) )
+        break;
+      pair += uint64_t(skip);
+      edges.push_back( decode( pair, self_loops ) );
+    }
+  } );
+  return chunks;
+}
+
+vector<EdgeList> gnm( size_type const vertex_count, size_type const edge_count, uint64_t const seed,
+                      ThreadPool& pool, bool const self_loops, bool const multi_edges )
+{
+  uint64_t const pairs = pairCount( vertex_count, self_loops );
+  if ( edge_count > 0 && (pairs == 0 || (!multi_edges && edge_count > pairs)) )
+    throw std::domain_error(
+        "Graph would be fully connected with " + to_string(pairs) + " edges, but " +
+        to_string(edge_count) + " were requested." );
+
+  vector<EdgeList> chunks( STREAM_COUNT );
+  if ( edge_count == 0 )
+    return chunks;
+
+  PairDraws draws( pairs, seed, pool );
+  bool complement = false;
+  if ( multi_edges ) {
+    draws.draw( edge_count, false );
+  } else {
+    // past half of the possible edges, choose the ones left out instead
+    complement = edge_count > pairs / 2;
+    uint64_t const wanted = complement ? pairs - edge_count : edge_count;
+
+    // d uniform draws leave about free * (1 - exp(-d / pairs)) of the free
+    // pairs drawn; ask for a little more than enough, then drop the surplus
+    uint64_t held = 0;
+    while ( held < wanted ) {
+      double const free = double(pairs - held);
+      double const needed = double(wanted - held);
+      held = draws.draw( uint64_t( -double(pairs) * std::log1p( -needed / free ) * 1.002 ) + 64, true );
+    }
+    draws.drop( held - wanted );
+  }
+
+  pool.parallelFor( STREAM_COUNT, [&]( size_t const block, size_t ) {
+    vector<uint64_t> const& picked = draws.picked( block );
+    EdgeList& edges = chunks[block];
+    if ( !complement ) {
+      edges.reserve( picked.size() );
+      for ( auto const pair : picked )
+        edges.push_back( decode( pair, self_loops ) );
+      return;
+    }
+
+    uint64_t const begin = blockBegin( pairs, block );
+    uint64_t const end = blockBegin( pairs, block + 1 );
+    edges.reserve( end - begin - picked.size() );
+    auto left_out = picked.begin();
+    for ( uint64_t pair = begin; pair < end; ++pair ) {
+      if ( left_out != picked.end() && *left_out == pair )
+        ++left_out;
+      else
+        edges.push_back( decode( pair, self_loops ) );
+    }
+  } );
+  return chunks;
+}
+
+} // namespace RandomGraphs
@@ -0,0 +1,116 @@
+/** \file TriangleCountingDriver.cpp
+ * Driver for TriangleCounting
+ *
+ * \author Brian Heim
+ * \date   2026-10-17
+ */
+
+#include "AbstractUGraph.hpp"
+#include "AMUGraph.hpp"
+#include "BinaryGraphFormat.hpp"
+#include "CSRUGraph.hpp"
+#include "EdgeListLoader.hpp"
+#include "ThreadPool.hpp"
+#include "TriangleCounting.hpp"
+
+#include <boost/program_options.hpp>
+
+#include <iomanip> // setw, setprecision
+#include <iostream>
+#include <string> // string
+
+using std::string;
+using std::cin;
+using std::cout;
+using std::endl;
+
+using VertexID = AbstractUGraph::VertexID;
+namespace bpo = boost::program_options;
+
+void parseProgramOptions( int argc, char **argv, bpo::options_description& desc, bpo::variables_map& vm )
+{
+  desc.add_options()
+    ("help,h"      , "Show this message")
+    ("input-file,i", "Input file to read, as an edge list or a binary graph")
+    ("threads,t"   , bpo::value<size_t>()->default_value(0), "Worker threads; 0 means one per hardware thread")
+    ("matrix,m"    , "Count on an adjacency matrix by bitset intersection; suits small dense graphs")
+    ("per-vertex,p", "Also print each vertex's triangles and clustering coefficient")
+    ;
+
+  // the positional argument is input-file
+  bpo::positional_options_description pod;
+  pod.add( "input-file", 1 );
+
+  bpo::store(
+      bpo::command_line_parser(argc, argv).options(desc).positional(pod).run(),
+      vm
+      );
+  bpo::notify( vm );
+}
+
+CSRUGraph parseGraph( bpo::variables_map& vm )
+{
+  try {
+    if ( vm.count("input-file") ) {
+      string filename = vm["input-file"].as<string>();
+      // binary graphs are mapped and used in place; text is parsed in parallel
+      if ( BinaryGraphFormat::isBinaryGraphFile(filename) )
+        return BinaryGraphFormat::map( filename );
+      return EdgeListLoader( filename ).build<CSRUGraph>();
+    } else {
+      return CSRUGraph( cin );
+    }
+  } catch ( std::exception const& e ) {
+    std::cerr << "*** " << e.what() << endl;
+    std::exit( EXIT_FAILURE );
+  }
+}
+
+/// Adjacency matrix with the edges of `graph`
+AMUGraph toMatrix( CSRUGraph const& graph )
+{
+  AMUGraph matrix( graph.v() );
+  for ( VertexID v = 0; v < graph.v(); ++v )
+    for ( auto const w : graph.neighbors(v) )
+      if ( v <= w )
+        matrix.addEdge( v, w );
+  return matrix;
+}
+
+void printCounts( TriangleTally const& tally, VertexID const vertex_count, bool const per_vertex )
+{
+  if ( per_vertex ) {
+    cout << "vertex  triangles  clustering\n";
+    for ( VertexID v = 0; v < vertex_count; ++v )
+      cout << std::setw(6) << v << "  " << std::setw(9) << tally.triangles(v) << "  "
+           << std::fixed << std::setprecision(4) << tally.clustering(v) << "\n";
+  }
+  cout << "The graph has " << tally.count() << " triangles; the average clustering coefficient is "
+       << std::fixed << std::setprecision(4) << tally.averageClustering() << endl;
+}
+
+int main( int argc, char **argv )
+{
+  bpo::options_description desc( "Allowed options" );
+  bpo::variables_map vm;
+  parseProgramOptions( argc, argv, desc, vm );
+
+  // if help is requested, just print help and exit
+  if ( vm.count("help") ) {
+    cout << desc << endl;
+    std::exit( EXIT_SUCCESS );
+  }
+
+  CSRUGraph ug = parseGraph( vm );
+  ThreadPool pool( vm["threads"].as<size_t>() );
+  bool const per_vertex = vm.count("per-vertex");
+
+  if ( vm.count("matrix") ) {
+    AMUGraph const matrix = toMatrix( ug );
+    printCounts( TriangleCounting<AMUGraph>( matrix, pool ), ug.v(), per_vertex );
+  } else {
+    printCounts( TriangleCounting<CSRUGraph>( ug, pool ), ug.v(), per_vertex );
+  }
+
+  std::exit( EXIT_SUCCESS );
+}
@@ -8,6 +8,9 @@
 #include "AbstractUGraph.hpp"
 #include "AMUGraph.hpp"
 #include "ALUGraph.hpp"
+#include "CSRUGraph.hpp"
+#include "CompressedUGraph.hpp"
+#include "GraphWriter.hpp"
 
 #include <iostream>
 #include <string>
@@ -23,6 +26,10 @@ AbstractUGraph * create_graph( string opt )
     return new AMUGraph( cin );
   else if ( opt == "-l" )
     return new ALUGraph( cin );
+  else if ( opt == "-c" )
+    return new CSRUGraph( cin );
+  else if ( opt == "-z" )
+    return new CompressedUGraph( cin );
   else
     throw std::runtime_error( "Unknown argument: " + opt );
 }
@@ -40,6 +47,6 @@ int main(int argc, char **argv)
   cout << "Undirected graph creation driver. Enter your graph: " << endl;
   AbstractUGraph * ug = create_graph( opt );
 
-  cout << ug->toString();
+  GraphWriter( cout ).writeAdjacencyLists( *ug );
   return 0;
 }
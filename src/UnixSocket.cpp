@@ -0,0 +1,244 @@
+/** \file UnixSocket.cpp
+ * Stream sockets in the Unix domain, carrying length-prefixed messages.
+ *
+ * \author Brian Heim
+ * \date   2026-10-17
+ */
+
+#include "UnixSocket.hpp"
+
+#include <algorithm> // min
+#include <cerrno> // errno
+#include <cstdint> // uint32_t
+#include <cstring> // memcpy, memset
+#include <string> // string, to_string
+#include <system_error> // system_error
+
+#include <fcntl.h> // fcntl
+#include <poll.h> // poll
+#include <sys/socket.h> // socket, bind, listen, accept, connect, send, recv, setsockopt
+#include <sys/stat.h> // lstat, S_ISSOCK
+#include <sys/un.h> // sockaddr_un
+#include <unistd.h> // close, unlink
+
+using std::string;
+using std::system_error;
+using std::system_category;
+using std::uint32_t;
+
+namespace {
+
+/// Address of the socket file at `path`
+sockaddr_un addressOf( string const& path )
+{
+  sockaddr_un address;
+  std::memset( &address, 0, sizeof address );
+  address.sun_family = AF_UNIX;
+  if ( path.size() >= sizeof address.sun_path )
+    throw system_error( ENAMETOOLONG, system_category(), "Can't use socket path " + path );
+  std::memcpy( address.sun_path, path.c_str(), path.size() + 1 );
+  return address;
+}
+
+/// Flags for `send`: where there's no SO_NOSIGPIPE, a vanished peer is
+/// kept from raising SIGPIPE per call
+#ifdef MSG_NOSIGNAL
+constexpr int SEND_FLAGS = MSG_NOSIGNAL;
+#else
+constexpr int SEND_FLAGS = 0;
+#endif
+
+/// Keeps `fd` from leaking into child processes and, where the socket
+/// itself can say so, from raising SIGPIPE; closes it if that fails
+void configure( int const fd )
+{
+  bool ok = ::fcntl( fd, F_SETFD, FD_CLOEXEC ) == 0;
+#ifdef SO_NOSIGPIPE
+  int const on = 1;
+  ok = ok && ::setsockopt( fd, SOL_SOCKET, SO_NOSIGPIPE, &on, sizeof on ) == 0;
+#endif
+  if ( !ok ) {
+    int const error = errno;
+    ::close( fd );
+    throw system_error( error, system_category(), "Can't configure socket" );
+  }
+}
+
+int openSocket( string const& path )
+{
+  int const fd = ::socket( AF_UNIX, SOCK_STREAM, 0 );
+  if ( fd < 0 )
+    throw system_error( errno, system_category(), "Can't create socket for " + path );
+  configure( fd );
+  return fd;
+}
+
+} // namespace
+
+uint32_t UnixSocket::messageLength( char const* header )
+{
+  uint32_t size = 0;
+  for ( size_t i = 0; i < HEADER_SIZE; ++i )
+    size |= uint32_t( static_cast<unsigned char>(header[i]) ) << (8 * i);
+  return size;
+}
+
+UnixSocket UnixSocket::listen( string const& path, int const backlog )
+{
+  sockaddr_un const address = addressOf( path );
+  UnixSocket socket( openSocket( path ) );
+
+  // a socket file left behind by an earlier server would make bind fail;
+  // any other file is someone else's
+  struct stat status;
+  if ( ::lstat( path.c_str(), &status ) == 0 ) {
+    if ( !S_ISSOCK( status.st_mode ) )
+      throw system_error( EEXIST, system_category(), "Can't listen on " + path + ", which is not a socket" );
+    if ( ::unlink( path.c_str() ) != 0 && errno != ENOENT )
+      throw system_error( errno, system_category(), "Can't remove " + path );
+  } else if ( errno != ENOENT ) {
+    throw system_error( errno, system_category(), "Can't check " + path );
+  }
+  if ( ::bind( socket._fd, reinterpret_cast<sockaddr const*>(&address), sizeof address ) != 0 )
+    throw system_error( errno, system_category(), "Can't bind " + path );
+  if ( ::listen( socket._fd, backlog ) != 0 )
+    throw system_error( errno, system_category(), "Can't listen on " + path );
+  return socket;
+}
+
+UnixSocket UnixSocket::connect( string const& path )
+{
+  sockaddr_un const address = addressOf( path );
+  UnixSocket socket( openSocket( path ) );
+  if ( ::connect( socket._fd, reinterpret_cast<sockaddr const*>(&address), sizeof address ) != 0 )
+    throw system_error( errno, system_category(), "Can't connect to " + path );
+  return socket;
+}
+
+UnixSocket& UnixSocket::operator=( UnixSocket&& other )
+{
+  if ( this != &other ) {
+    close();
+    _fd = other._fd;
+    other._fd = -1;
+  }
+  return *this;
+}
+
+UnixSocket UnixSocket::accept() const
+{
+  int fd;
+  do {
+    fd = ::accept( _fd, nullptr, nullptr );
+  } while ( fd < 0 && errno == EINTR );
+  if ( fd < 0 )
+    throw system_error( errno, system_category(), "Can't accept a connection" );
+  configure( fd );
+  return UnixSocket( fd );
+}
+
+void UnixSocket::setNonBlocking( bool const non_blocking ) const
+{
+  int const flags = ::fcntl( _fd, F_GETFL );
+  if ( flags < 0 ||
+       ::fcntl( _fd, F_SETFL, non_blocking ? (flags | O_NONBLOCK) : (flags & ~O_NONBLOCK) ) != 0 )
+    throw system_error( errno, system_category(), "Can't change socket blocking mode" );
+}
+
+void UnixSocket::send( char const* data, size_t size ) const
+{
+  while ( size > 0 ) {
+    ssize_t const sent = ::send( _fd, data, size, SEND_FLAGS );
+    if ( sent < 0 ) {
+      if ( errno == EINTR )
+        continue;
+      if ( errno == EAGAIN || errno == EWOULDBLOCK ) {
+        // a non-blocking socket is full: wait for the peer to read
+        pollfd writable = { _fd, POLLOUT, 0 };
+        if ( ::poll( &writable, 1, -1 ) < 0 && errno != EINTR )
+          throw system_error( errno, system_category(), "Can't poll socket" );
+        continue;
+      }
+      throw system_error( errno, system_category(), "Can't send on socket" );
+    }
+    data += sent;
+    size -= sent;
+  }
+}
+
+bool UnixSocket::receive( char* data, size_t size ) const
+{
+  size_t received = 0;
+  while ( received < size ) {
+    ssize_t const n = ::recv( _fd, data + received, size - received, 0 );
+    if ( n < 0 ) {
+      if ( errno == EINTR )
+        continue;
+      throw system_error( errno, system_category(), "Can't receive on socket" );
+    }
+    if ( n == 0 ) {
+      if ( received == 0 )
+        return false;
+      throw system_error( ECONNRESET, system_category(), "Connection closed mid-message" );
+    }
+    received += n;
+  }
+  return true;
+}
+
+long UnixSocket::receiveAvailable( char* data, size_t size ) const
+{
+  for ( ;; ) {
+    ssize_t const n = ::recv( _fd, data, size, 0 );
+    if ( n >= 0 )
+      return n;
+    if ( errno == EAGAIN || errno == EWOULDBLOCK )
+      return -1;
+    if ( errno != EINTR )
+      throw system_error( errno, system_category(), "Can't receive on socket" );
+  }
+}
+
+void UnixSocket::sendMessage( string const& message ) const
+{
+  if ( message.size() > MAX_MESSAGE )
+    throw system_error( EMSGSIZE, system_category(), "Can't send a message of " + std::to_string(message.size()) + " bytes" );
+
+  // the header and message go out in one write, one system call a message
+  uint32_t const size = uint32_t( message.size() );
+  string frame( HEADER_SIZE, '\0' );
+  for ( size_t i = 0; i < HEADER_SIZE; ++i )
+    frame[i] = char( (size >> (8 * i)) & 0xff );
+  frame += message;
+  send( frame.data(), frame.size() );
+}
+
+bool UnixSocket::receiveMessage( string& message ) const
+{
+  char header[HEADER_SIZE];
+  if ( !receive( header, sizeof header ) )
+    return false;
+
+  uint32_t const size = messageLength( header );
+  if ( size > MAX_MESSAGE )
+    throw system_error( EMSGSIZE, system_category(), "Can't receive a message of " + std::to_string(size) + " bytes" );
+
+  // grow with what arrives, so a bad length can't claim the memory up front
+  static constexpr size_t CHUNK = 1 << 16;
+  message.clear();
+  while ( message.size() < size ) {
+    size_t const done = message.size();
+    message.resize( done + std::min<size_t>( CHUNK, size - done ) );
+    if ( !receive( &message[done], message.size() - done ) )
+      throw system_error( ECONNRESET, system_category(), "Connection closed mid-message" );
+  }
+  return true;
+}
+
+void UnixSocket::close()
+{
+  if ( _fd >= 0 ) {
+    ::close( _fd );
+    _fd = -1;
+  }
+}
@@ -0,0 +1,95 @@
+/** \file VertexOrdering.cpp
+ * Relabeling of graphs by a vertex ordering.
+ *
+ * \author Brian Heim
+ * \date   2026-10-17
+ */
+
+#include "VertexOrdering.hpp"
+
+#include <algorithm> // sort
+#include <memory> // make_shared
+#include <stdexcept> // invalid_argument
+#include <string> // to_string
+#include <utility> // move
+
+using std::to_string;
+using std::vector;
+
+typedef AbstractUGraph::VertexID VertexID;
+typedef AbstractUGraph::size_type size_type;
+
+namespace {
+
+void checkSize( AbstractUGraph const& graph, Permutation const& permutation )
+{
+  if ( graph.v() != permutation.size() )
+    throw std::invalid_argument(
+        "A permutation of " + to_string(permutation.size()) + " vertices can't relabel a graph with " +
+        to_string(graph.v()) + " vertices" );
+}
+
+/// Arrays backing a relabeled CSRUGraph
+struct CSRStorage
+{
+  vector<size_type> offsets;
+  vector<VertexID> neighbors;
+};
+
+} // namespace
+
+CSRUGraph VertexOrdering::relabel( CSRUGraph const& graph, Permutation const& permutation )
+{
+  checkSize( graph, permutation );
+  size_type const vertex_count = graph.v();
+
+  auto storage = std::make_shared<CSRStorage>();
+  storage->offsets.resize( vertex_count + 1 );
+  storage->offsets[0] = 0;
+  for ( size_type u = 0; u < vertex_count; ++u )
+    storage->offsets[u+1] = storage->offsets[u] + graph.degree( permutation.toOld(u) );
+
+  storage->neighbors.resize( storage->offsets[vertex_count] );
+  for ( size_type u = 0; u < vertex_count; ++u ) {
+    auto out = storage->neighbors.begin() + storage->offsets[u];
+    for ( auto const w : graph.neighbors(permutation.toOld(u)) )
+      *out++ = permutation.toNew( w );
+    std::sort( storage->neighbors.begin() + storage->offsets[u], out );
+  }
+
+  size_type const* const offsets = storage->offsets.data();
+  VertexID const* const neighbors = storage->neighbors.data();
+  return CSRUGraph( std::move(storage), offsets, neighbors, vertex_count, graph.e() );
+}
+
+ALUGraph VertexOrdering::relabel( ALUGraph const& graph, Permutation const& permutation )
+{
+  checkSize( graph, permutation );
+  size_type const vertex_count = graph.v();
+
+  // add each edge from its lower new endpoint, in increasing order, so that
+  // every list is built up sorted
+  ALUGraph relabeled( vertex_count );
+  vector<VertexID> higher;
+  for ( size_type u = 0; u < vertex_count; ++u ) {
+    size_type self_loop_entries = 0;
+    higher.clear();
+    for ( auto const w : graph.neighbors(permutation.toOld(u)) ) {
+      VertexID const new_w = permutation.toNew( w );
+      if ( new_w == u )
+        ++self_loop_entries;
+      else if ( new_w > u )
+        higher.push_back( new_w );
+    }
+
+    // a self-loop appears twice in its list
+    for ( size_type i = 0; i < self_loop_entries / 2; ++i )
+      relabeled.addEdge( u, u );
+
+    std::sort( higher.begin(), higher.end() );
+    for ( auto const w : higher )
+      relabeled.addEdge( u, w );
+  }
+
+  return relabeled;
+}